@@ -106,6 +106,7 @@ option(WITH_DYNAMIC_LINKING "Enable dynamic library linking."
 option(WITH_STRICT_DATABASE_TYPE_CHECKS "Enable strict checking of database field value accessors" 0)
 option(WITHOUT_METRICS     "Disable metrics reporting (i.e. InfluxDB and Grafana)"       0)
 option(WITH_DETAILED_METRICS  "Enable detailed metrics reporting (i.e. time each session takes to update)" 0)
+option(WITH_MEMORY_TRACKING "Account heap memory per subsystem (replaces the global operator new and delete)" 0)
 
 CheckApplicationsBuildList()
 CheckToolsBuildList()
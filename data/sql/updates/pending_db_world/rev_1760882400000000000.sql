@@ -0,0 +1,3 @@
+--
+DELETE FROM `command` WHERE `name` = 'server pools';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES ('server pools', 3, 'Syntax: .server pools\r\nShow the object pools of creatures, gameobjects, dynamic objects, spells and auras: live objects, allocations served from the pool and from the heap, and free blocks waiting to be reused.');
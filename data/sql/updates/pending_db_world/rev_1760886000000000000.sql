@@ -0,0 +1,3 @@
+--
+DELETE FROM `command` WHERE `name` = 'server memory';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES ('server memory', 3, 'Syntax: .server memory\r\nShow the heap memory still allocated by each subsystem (map, world session, object manager, database, loot). Requires a core built with WITH_MEMORY_TRACKING.');
@@ -168,6 +168,16 @@ elseif (WITH_DETAILED_METRICS)
   add_definitions(-DWITH_DETAILED_METRICS)
 endif()
 
+if(WITH_MEMORY_TRACKING)
+  message("")
+  message(" *** WITH_MEMORY_TRACKING - WARNING!")
+  message(" *** Please note that this adds a 16 byte header to every allocation made through operator new")
+  if(WIN32 AND BUILD_SHARED_LIBS)
+    message(FATAL_ERROR "WITH_MEMORY_TRACKING replaces operator new in the common library, which does not apply to other DLLs. Disable WITH_DYNAMIC_LINKING.")
+  endif()
+  add_definitions(-DACORE_MEMORY_TRACKING)
+endif()
+
 if(MSAN)
     message("")
     message(" *** MSAN - WARNING!")
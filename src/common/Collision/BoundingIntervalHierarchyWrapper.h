@@ -65,29 +65,62 @@ class BIHWrap
 
     typedef G3D::Array<const T*> ObjArray;
 
+    // models inserted since the last build are tested one by one until this many are pending
+    static constexpr int MAX_PENDING_OBJECTS = 8;
+
     BIH m_tree;
     ObjArray m_objects;
+    G3D::Array<G3D::AABox> m_bounds;                // bounds of each slot when the tree was built
     G3D::Table<const T*, uint32> m_obj2Idx;
+    G3D::Table<const T*, uint32> m_removedObj2Idx;  // removed models whose slot is still empty
     G3D::Set<const T*> m_objects_to_push;
-    int unbalanced_times;
+    int removed_objects;
+
+    // removed models leave an empty slot in the built tree, pending ones are scanned linearly,
+    // so moving doors and transports only force a rebuild once too many of them piled up
+    bool needsRebuild() const
+    {
+        return m_objects_to_push.size() > MAX_PENDING_OBJECTS || removed_objects * 4 > m_objects.size();
+    }
 
 public:
-    BIHWrap() : unbalanced_times(0) { }
+    BIHWrap() : removed_objects(0) { }
 
     void insert(const T& obj)
     {
-        ++unbalanced_times;
+        if (m_obj2Idx.containsKey(&obj))
+        {
+            return;
+        }
+
+        // a toggled door comes back with the bounds it was built with and can take its old slot again
+        uint32 Idx = 0;
+        if (m_removedObj2Idx.get(&obj, Idx))
+        {
+            G3D::AABox bounds;
+            BoundsFunc::GetBounds(obj, bounds);
+            if (bounds == m_bounds[Idx])
+            {
+                m_removedObj2Idx.remove(&obj);
+                m_objects[Idx] = &obj;
+                m_obj2Idx.set(&obj, Idx);
+                --removed_objects;
+                return;
+            }
+        }
+
         m_objects_to_push.insert(&obj);
     }
 
     void remove(const T& obj)
     {
-        ++unbalanced_times;
         uint32 Idx = 0;
         const T* temp;
         if (m_obj2Idx.getRemove(&obj, temp, Idx))
         {
             m_objects[Idx] = nullptr;
+            m_removedObj2Idx.set(&obj, Idx);
+            ++removed_objects;
         }
         else
         {
@@ -97,16 +130,25 @@ public:
 
     void balance()
     {
-        if (unbalanced_times == 0)
+        if (m_objects_to_push.size() == 0 && removed_objects == 0)
         {
             return;
         }
 
-        unbalanced_times = 0;
-        m_objects.fastClear();
+        ObjArray pending;
+        m_objects_to_push.getMembers(pending);
+        m_objects_to_push.clear();
+
+        removed_objects = 0;
+        m_removedObj2Idx.clear();
         m_obj2Idx.getKeys(m_objects);
-        m_objects_to_push.getMembers(m_objects);
-        //assert that m_obj2Idx has all the keys
+        m_objects.append(pending);
+        m_bounds.resize(m_objects.size());
+        for (int i = 0; i < m_objects.size(); ++i)
+        {
+            m_obj2Idx.set(m_objects[i], i);
+            BoundsFunc::GetBounds2(m_objects[i], m_bounds[i]);
+        }
 
         m_tree.build(m_objects, BoundsFunc::GetBounds2);
     }
@@ -114,17 +156,38 @@ public:
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& maxDist, bool stopAtFirstHit)
     {
-        balance();
+        if (needsRebuild())
+        {
+            balance();
+        }
+
         MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectRay(ray, temp_cb, maxDist, stopAtFirstHit);
+
+        for (typename G3D::Set<const T*>::Iterator itr = m_objects_to_push.begin(); itr != m_objects_to_push.end(); ++itr)
+        {
+            if (intersectCallback(ray, **itr, maxDist, stopAtFirstHit) && stopAtFirstHit)
+            {
+                return;
+            }
+        }
     }
 
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& point, IsectCallback& intersectCallback)
     {
-        balance();
+        if (needsRebuild())
+        {
+            balance();
+        }
+
         MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectPoint(point, callback);
+
+        for (typename G3D::Set<const T*>::Iterator itr = m_objects_to_push.begin(); itr != m_objects_to_push.end(); ++itr)
+        {
+            intersectCallback(point, **itr);
+        }
     }
 };
 
@@ -0,0 +1,261 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BufferAllocator.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t MinSizeShift = std::bit_width(Acore::BufferPool::MinPooledSize - 1);
+    constexpr std::size_t SizeClasses = std::bit_width(Acore::BufferPool::MaxPooledSize - 1) - MinSizeShift + 1;
+    constexpr std::size_t MaxThreadBytesPerClass = 256 * 1024;
+    constexpr std::size_t MaxDepotBatches = 32;
+    constexpr uint32 StatisticsFlushInterval = 256;
+
+    std::size_t GetSizeClass(std::size_t size)
+    {
+        return size <= Acore::BufferPool::MinPooledSize ? 0 : std::bit_width(size - 1) - MinSizeShift;
+    }
+
+    std::size_t GetClassSize(std::size_t sizeClass)
+    {
+        return std::size_t(1) << (sizeClass + MinSizeShift);
+    }
+
+    std::size_t GetMaxThreadBlocks(std::size_t sizeClass)
+    {
+        return std::clamp<std::size_t>(MaxThreadBytesPerClass / GetClassSize(sizeClass), 4, 64);
+    }
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* Head = nullptr;
+        std::size_t Count = 0;
+
+        void Push(void* ptr)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = Head;
+            Head = block;
+            ++Count;
+        }
+
+        void* Pop()
+        {
+            FreeBlock* block = Head;
+            Head = block->Next;
+            --Count;
+            return block;
+        }
+
+        void Release()
+        {
+            while (Head)
+                ::operator delete(Pop());
+        }
+    };
+
+    /// Batches of blocks handed over between threads
+    struct Depot
+    {
+        ~Depot()
+        {
+            for (FreeList& batch : Batches)
+                batch.Release();
+        }
+
+        std::mutex Lock;
+        std::vector<FreeList> Batches;
+    };
+
+    std::array<Depot, SizeClasses> Depots;
+
+    std::atomic<uint64> PoolAllocations{0};
+    std::atomic<uint64> HeapAllocations{0};
+    std::atomic<uint64> Deallocations{0};
+
+    void PushToDepot(std::size_t sizeClass, FreeList& batch)
+    {
+        {
+            Depot& depot = Depots[sizeClass];
+            std::lock_guard<std::mutex> lock(depot.Lock);
+            if (depot.Batches.size() < MaxDepotBatches)
+            {
+                depot.Batches.push_back(batch);
+                batch = FreeList();
+                return;
+            }
+        }
+
+        batch.Release();
+    }
+
+    bool PopFromDepot(std::size_t sizeClass, FreeList& list)
+    {
+        Depot& depot = Depots[sizeClass];
+        std::lock_guard<std::mutex> lock(depot.Lock);
+        if (depot.Batches.empty())
+            return false;
+
+        list = depot.Batches.back();
+        depot.Batches.pop_back();
+        return true;
+    }
+
+    class ThreadCache
+    {
+    public:
+        ~ThreadCache();
+
+        void* Allocate(std::size_t sizeClass);
+        void Deallocate(void* ptr, std::size_t sizeClass);
+
+        void CountHeapAllocation();
+        void CountDeallocation();
+
+    private:
+        void CountOperation();
+        void FlushStatistics();
+
+        std::array<FreeList, SizeClasses> _lists;
+        uint64 _poolAllocations = 0;
+        uint64 _heapAllocations = 0;
+        uint64 _deallocations = 0;
+        uint32 _pendingOperations = 0;
+    };
+
+    thread_local ThreadCache Cache;
+    thread_local bool CacheDestroyed = false;   // buffers freed during thread teardown bypass the pool
+
+    ThreadCache::~ThreadCache()
+    {
+        CacheDestroyed = true;
+
+        for (std::size_t sizeClass = 0; sizeClass < SizeClasses; ++sizeClass)
+            if (_lists[sizeClass].Head)
+                PushToDepot(sizeClass, _lists[sizeClass]);
+
+        FlushStatistics();
+    }
+
+    void* ThreadCache::Allocate(std::size_t sizeClass)
+    {
+        FreeList& list = _lists[sizeClass];
+        if (!list.Head && !PopFromDepot(sizeClass, list))
+        {
+            CountHeapAllocation();
+            return ::operator new(GetClassSize(sizeClass));
+        }
+
+        ++_poolAllocations;
+        CountOperation();
+        return list.Pop();
+    }
+
+    void ThreadCache::Deallocate(void* ptr, std::size_t sizeClass)
+    {
+        CountDeallocation();
+
+        FreeList& list = _lists[sizeClass];
+        list.Push(ptr);
+
+        std::size_t maxBlocks = GetMaxThreadBlocks(sizeClass);
+        if (list.Count <= maxBlocks)
+            return;
+
+        // hand half of the blocks to threads that allocate more than they free
+        FreeList batch;
+        while (batch.Count < maxBlocks / 2)
+            batch.Push(list.Pop());
+
+        PushToDepot(sizeClass, batch);
+    }
+
+    void ThreadCache::CountHeapAllocation()
+    {
+        ++_heapAllocations;
+        CountOperation();
+    }
+
+    void ThreadCache::CountDeallocation()
+    {
+        ++_deallocations;
+        CountOperation();
+    }
+
+    void ThreadCache::CountOperation()
+    {
+        if (++_pendingOperations >= StatisticsFlushInterval)
+            FlushStatistics();
+    }
+
+    void ThreadCache::FlushStatistics()
+    {
+        PoolAllocations.fetch_add(_poolAllocations, std::memory_order_relaxed);
+        HeapAllocations.fetch_add(_heapAllocations, std::memory_order_relaxed);
+        Deallocations.fetch_add(_deallocations, std::memory_order_relaxed);
+        _poolAllocations = _heapAllocations = _deallocations = 0;
+        _pendingOperations = 0;
+    }
+}
+
+void* Acore::BufferPool::Allocate(std::size_t size)
+{
+    if (size > MaxPooledSize || CacheDestroyed)
+    {
+        if (!CacheDestroyed)
+            Cache.CountHeapAllocation();
+
+        return ::operator new(size);
+    }
+
+    return Cache.Allocate(GetSizeClass(size));
+}
+
+void Acore::BufferPool::Deallocate(void* ptr, std::size_t size)
+{
+    if (size > MaxPooledSize || CacheDestroyed)
+    {
+        if (!CacheDestroyed)
+            Cache.CountDeallocation();
+
+        ::operator delete(ptr);
+        return;
+    }
+
+    Cache.Deallocate(ptr, GetSizeClass(size));
+}
+
+Acore::BufferPool::Statistics Acore::BufferPool::GetStatistics()
+{
+    Statistics statistics;
+    statistics.PoolAllocations = PoolAllocations.load(std::memory_order_relaxed);
+    statistics.HeapAllocations = HeapAllocations.load(std::memory_order_relaxed);
+    statistics.Deallocations = Deallocations.load(std::memory_order_relaxed);
+    return statistics;
+}
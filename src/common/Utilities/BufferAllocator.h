@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BUFFER_ALLOCATOR_H
+#define _BUFFER_ALLOCATOR_H
+
+#include "Define.h"
+#include <cstddef>
+
+namespace Acore
+{
+    /**
+     * Pool for the byte storage of network and packet buffers.
+     *
+     * Requests up to MaxPooledSize bytes are rounded up to a power of two size class and served
+     * from a per thread free list. Buffers are usually built on a map thread and freed on a network
+     * thread, so full thread lists hand half of their blocks to a shared depot in batches where
+     * threads with empty lists pick them up again. Larger requests go directly to the global heap.
+     */
+    namespace BufferPool
+    {
+        constexpr std::size_t MinPooledSize = 64;
+        constexpr std::size_t MaxPooledSize = 64 * 1024;
+
+        struct Statistics
+        {
+            uint64 PoolAllocations = 0;     // served from a thread list or the depot
+            uint64 HeapAllocations = 0;     // pool empty or size not pooled
+            uint64 Deallocations = 0;
+        };
+
+        AC_COMMON_API void* Allocate(std::size_t size);
+        AC_COMMON_API void Deallocate(void* ptr, std::size_t size);
+
+        /// Counters are flushed from the threads in batches, recent operations may not be included yet.
+        AC_COMMON_API Statistics GetStatistics();
+    }
+
+    template<typename T>
+    class BufferAllocator
+    {
+    public:
+        typedef T value_type;
+
+        BufferAllocator() noexcept = default;
+
+        template<typename U>
+        BufferAllocator(BufferAllocator<U> const&) noexcept { }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(BufferPool::Allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            BufferPool::Deallocate(ptr, count * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(BufferAllocator<U> const&) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(BufferAllocator<U> const&) const noexcept { return false; }
+    };
+}
+
+#endif // _BUFFER_ALLOCATOR_H
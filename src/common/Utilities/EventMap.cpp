@@ -18,6 +18,8 @@
 #include "EventMap.h"
 #include "Random.h"
 
+#include <algorithm>
+
 void EventMap::Reset()
 {
     _eventMap.clear();
@@ -65,7 +67,7 @@ void EventMap::ScheduleEvent(uint32 eventId, uint32 time, uint32 group /*= 0*/,
         eventId |= (1 << (phase + 23));
     }
 
-    _eventMap.emplace(_time + time, eventId);
+    Insert(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group /*= 0*/, uint8 phase /* = 0*/)
@@ -98,7 +100,7 @@ void EventMap::RescheduleEvent(uint32 eventId, Milliseconds minTime, Millisecond
 
 void EventMap::RepeatEvent(uint32 time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds time)
@@ -115,21 +117,21 @@ uint32 EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        auto const& itr = _eventMap.begin();
+        EventEntry const& next = _eventMap.back();
 
-        if (itr->first > _time)
+        if (next.first > _time)
         {
             return 0;
         }
-        else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
+        else if (_phase && (next.second & 0xFF000000) && !((next.second >> 24) & _phase))
         {
-            _eventMap.erase(itr);
+            _eventMap.pop_back();
         }
         else
         {
-            uint32 eventId = (itr->second & 0x0000FFFF);
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
+            uint32 eventId = (next.second & 0x0000FFFF);
+            _lastEvent = next.second;
+            _eventMap.pop_back();
             return eventId;
         }
     }
@@ -154,36 +156,44 @@ void EventMap::DelayEvents(uint32 delay, uint32 group)
         return;
     }
 
+    EventStore remaining;
     EventStore delayed;
 
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    for (EventEntry const& entry : _eventMap)
     {
-        if (!group || (itr->second & (1 << (group + 15))))
-        {
-            delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
+        if (!group || (entry.second & (1 << (group + 15))))
+            delayed.push_back(entry);
+        else
+            remaining.push_back(entry);
     }
 
-    _eventMap.insert(delayed.begin(), delayed.end());
+    _eventMap.swap(remaining);
+
+    // reinsert in execution order so delayed events keep their relative order
+    for (auto itr = delayed.rbegin(); itr != delayed.rend(); ++itr)
+    {
+        Insert(itr->first + delay, itr->second);
+    }
 }
 
 void EventMap::DelayEventsToMax(uint32 delay, uint32 group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    EventStore remaining;
+    EventStore delayed;
+
+    for (EventEntry const& entry : _eventMap)
     {
-        if (itr->first < _time + delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
-        {
-            ScheduleEvent(itr->second, delay);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
+        if (entry.first < _time + delay && (group == 0 || ((1 << (group + 15)) & entry.second)))
+            delayed.push_back(entry);
+        else
+            remaining.push_back(entry);
+    }
+
+    _eventMap.swap(remaining);
 
-        ++itr;
+    for (auto itr = delayed.rbegin(); itr != delayed.rend(); ++itr)
+    {
+        ScheduleEvent(itr->second, delay);
     }
 }
 
@@ -194,16 +204,10 @@ void EventMap::CancelEvent(uint32 eventId)
         return;
     }
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [eventId](EventEntry const& entry)
     {
-        if (eventId == (itr->second & 0x0000FFFF))
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+        return eventId == (entry.second & 0x0000FFFF);
+    }), _eventMap.end());
 }
 
 void EventMap::CancelEventGroup(uint32 group)
@@ -214,17 +218,10 @@ void EventMap::CancelEventGroup(uint32 group)
     }
 
     uint32 groupMask = (1 << (group + 15));
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [groupMask](EventEntry const& entry)
     {
-        if (itr->second & groupMask)
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+        return (entry.second & groupMask) != 0;
+    }), _eventMap.end());
 }
 
 uint32 EventMap::GetNextEventTime(uint32 eventId) const
@@ -234,11 +231,11 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
         return 0;
     }
 
-    for (auto const& itr : _eventMap)
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
     {
-        if (eventId == (itr.second & 0x0000FFFF))
+        if (eventId == (itr->second & 0x0000FFFF))
         {
-            return itr.first;
+            return itr->first;
         }
     }
 
@@ -247,7 +244,7 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
 
 uint32 EventMap::GetNextEventTime() const
 {
-    return Empty() ? 0 : _eventMap.begin()->first;
+    return Empty() ? 0 : _eventMap.back().first;
 }
 
 bool EventMap::IsInPhase(uint8 phase)
@@ -257,9 +254,16 @@ bool EventMap::IsInPhase(uint8 phase)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<uint32 const, uint32> const& itr : _eventMap)
-        if (eventId == (itr.second & 0x0000FFFF))
-            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr.first) - Milliseconds(_time));
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == (itr->second & 0x0000FFFF))
+            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr->first) - Milliseconds(_time));
 
     return Milliseconds::max();
 }
+
+void EventMap::Insert(uint32 time, uint32 data)
+{
+    // sorted by descending time, insert in front of events with the same time so those are executed first
+    auto itr = std::lower_bound(_eventMap.begin(), _eventMap.end(), time, [](EventEntry const& entry, uint32 value) { return entry.first > value; });
+    _eventMap.emplace(itr, time, data);
+}
@@ -20,14 +20,17 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <boost/container/small_vector.hpp>
 
 class EventMap
 {
     /**
     * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * First: Time as TimePoint when the event should occur.
+    * Second: The event data as uint32.
+    *
+    * Kept sorted by descending time so the next event is at the back,
+    * events with the same time are executed in the order they were scheduled.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
@@ -35,7 +38,8 @@ class EventMap
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
     */
-    typedef std::multimap<uint32, uint32> EventStore;
+    typedef std::pair<uint32, uint32> EventEntry;
+    typedef boost::container::small_vector<EventEntry, 8> EventStore;
 
 public:
     EventMap() { }
@@ -286,6 +290,12 @@ public:
     Milliseconds GetTimeUntilEvent(uint32 eventId) const;
 
 private:
+    /**
+    * @name Insert
+    * @brief Inserts the event data behind all already scheduled events with the same time.
+    */
+    void Insert(uint32 time, uint32 data);
+
     /**
     * @name _time
     * @brief Internal timer.
@@ -17,6 +17,90 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    bool EventListEntryGreater(EventListEntry const& left, EventListEntry const& right)
+    {
+        if (left.ExecTime != right.ExecTime)
+            return left.ExecTime > right.ExecTime;
+
+        return left.Sequence > right.Sequence;
+    }
+
+    class BasicEventAllocator
+    {
+    public:
+        static constexpr std::size_t Granularity = 32;
+        static constexpr std::size_t SizeClasses = 8;        // up to 256 bytes, larger events use the global heap
+        static constexpr std::size_t MaxFreeBlocks = 1024;   // per size class and thread
+
+        ~BasicEventAllocator();
+
+        void* Allocate(std::size_t size);
+        void Deallocate(void* ptr, std::size_t size);
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        std::array<FreeBlock*, SizeClasses> _freeLists{};
+        std::array<std::size_t, SizeClasses> _freeCounts{};
+    };
+
+    thread_local BasicEventAllocator EventAllocator;
+    thread_local bool EventAllocatorDestroyed = false;   // events deleted during thread teardown bypass the free lists
+
+    BasicEventAllocator::~BasicEventAllocator()
+    {
+        EventAllocatorDestroyed = true;
+
+        for (FreeBlock* block : _freeLists)
+        {
+            while (block)
+            {
+                FreeBlock* next = block->Next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+    }
+
+    void* BasicEventAllocator::Allocate(std::size_t size)
+    {
+        std::size_t sizeClass = (size - 1) / Granularity;
+        if (sizeClass >= SizeClasses)
+            return ::operator new(size);
+
+        if (FreeBlock* block = _freeLists[sizeClass])
+        {
+            _freeLists[sizeClass] = block->Next;
+            --_freeCounts[sizeClass];
+            return block;
+        }
+
+        return ::operator new((sizeClass + 1) * Granularity);
+    }
+
+    void BasicEventAllocator::Deallocate(void* ptr, std::size_t size)
+    {
+        std::size_t sizeClass = (size - 1) / Granularity;
+        if (sizeClass >= SizeClasses || _freeCounts[sizeClass] >= MaxFreeBlocks)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->Next = _freeLists[sizeClass];
+        _freeLists[sizeClass] = block;
+        ++_freeCounts[sizeClass];
+    }
+}
 
 void BasicEvent::ScheduleAbort()
 {
@@ -32,6 +116,25 @@ void BasicEvent::SetAborted()
     m_abortState = AbortState::STATE_ABORTED;
 }
 
+void* BasicEvent::operator new(std::size_t size)
+{
+    if (EventAllocatorDestroyed)
+        return ::operator new(size);
+
+    return EventAllocator.Allocate(size);
+}
+
+void BasicEvent::operator delete(void* ptr, std::size_t size)
+{
+    if (EventAllocatorDestroyed)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    EventAllocator.Deallocate(ptr, size);
+}
+
 EventProcessor::~EventProcessor()
 {
     KillAllEvents(true);
@@ -43,12 +146,12 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.front().ExecTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        std::pop_heap(m_events.begin(), m_events.end(), EventListEntryGreater);
+        BasicEvent* event = m_events.back().Event;
+        m_events.pop_back();
 
         if (event->IsRunning())
         {
@@ -81,56 +184,61 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
+    // detach the queue first, Abort() and destructors may add new events
+    EventList events;
+    events.swap(m_events);
+    m_events.reserve(events.size());
+
     // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (EventListEntry& entry : events)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!entry.Event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            entry.Event->SetAborted();
+            entry.Event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        if (!force && !entry.Event->IsDeletable())
         {
-            ++itr;
+            m_events.push_back(entry);
             continue;
         }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        delete entry.Event;
     }
 
-    if (force)
-        m_events.clear();
+    RebuildEventList();
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // detach the queue first, Abort() and destructors may add new events
+    EventList events;
+    events.swap(m_events);
+    m_events.reserve(events.size());
+
+    for (EventListEntry& entry : events)
     {
-        if (itr->second->m_eventGroup != group)
+        if (entry.Event->m_eventGroup != group)
         {
-            ++itr;
+            m_events.push_back(entry);
             continue;
         }
 
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!entry.Event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            entry.Event->SetAborted();
+            entry.Event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        delete entry.Event;
     }
+
+    RebuildEventList();
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime, uint8 eventGroup)
@@ -139,21 +247,25 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    m_events.push_back({ e_time, m_sequence++, Event });
+    std::push_heap(m_events.begin(), m_events.end(), EventListEntryGreater);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    auto itr = std::find_if(m_events.begin(), m_events.end(), [event](EventListEntry const& entry) { return entry.Event == event; });
+    if (itr == m_events.end())
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    event->m_execTime = newTime.count();
+    itr->ExecTime = newTime.count();
+    itr->Sequence = m_sequence++;
+    RebuildEventList();
+}
+
+void EventProcessor::RebuildEventList()
+{
+    std::make_heap(m_events.begin(), m_events.end(), EventListEntryGreater);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -21,7 +21,7 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
-#include <map>
+#include <vector>
 
 class EventProcessor;
 
@@ -56,6 +56,10 @@ class BasicEvent
         // Aborts the event at the next update tick
         void ScheduleAbort();
 
+        // events are created and destroyed at a high rate, small ones are recycled through per thread free lists
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr, std::size_t size);
+
     private:
         void SetAborted();
         [[nodiscard]] bool IsRunning() const { return (m_abortState == AbortState::STATE_RUNNING); }
@@ -90,7 +94,15 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+struct EventListEntry
+{
+    uint64 ExecTime;
+    uint64 Sequence;                                        // keeps events with the same execution time in insertion order
+    BasicEvent* Event;
+};
+
+// binary min heap ordered by execution time, see EventProcessor::AddEvent
+typedef std::vector<EventListEntry> EventList;
 
 class EventProcessor
 {
@@ -123,7 +135,10 @@ class EventProcessor
         void CancelEventGroup(uint8 group);
 
     protected:
+        void RebuildEventList();
+
         uint64 m_time{0};
+        uint64 m_sequence{0};
         EventList m_events;
         bool m_aborting;
 };
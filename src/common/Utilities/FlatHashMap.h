@@ -0,0 +1,442 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _FLAT_HASH_MAP_H
+#define _FLAT_HASH_MAP_H
+
+#include "Define.h"
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Acore
+{
+    namespace Impl
+    {
+        /**
+         * Open addressing hash table with linear probing.
+         *
+         * Elements live in one array next to a byte of state per slot, so lookups touch one or two cache
+         * lines instead of following a node pointer per element. The user hash is mixed with a 64 bit
+         * multiplicative hash, which keeps identity hashes (guids, ids) spread over the table.
+         *
+         * Erasing leaves a tombstone, so erasing while iterating is safe. Inserting may move all elements:
+         * unlike std::unordered_map, references and iterators do not survive an insertion.
+         */
+        template<typename Key, typename Slot, typename KeyOf, typename Hash, typename KeyEqual>
+        class FlatHashTable
+        {
+            enum : uint8
+            {
+                SLOT_EMPTY      = 0,
+                SLOT_DELETED    = 1,
+                SLOT_FULL       = 2
+            };
+
+            static constexpr std::size_t MinCapacity = 8;
+
+        public:
+            template<bool Const>
+            class Iterator
+            {
+                friend class FlatHashTable;
+                typedef std::conditional_t<Const, FlatHashTable const*, FlatHashTable*> TablePtr;
+
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef Slot value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef std::conditional_t<Const, Slot const*, Slot*> pointer;
+                typedef std::conditional_t<Const, Slot const&, Slot&> reference;
+
+                Iterator() = default;
+
+                template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+                Iterator(Iterator<OtherConst> const& other) : _table(other._table), _index(other._index) { }
+
+                reference operator*() const { return _table->_slots[_index]; }
+                pointer operator->() const { return &_table->_slots[_index]; }
+
+                Iterator& operator++()
+                {
+                    _index = _table->NextFull(_index + 1);
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator itr = *this;
+                    ++*this;
+                    return itr;
+                }
+
+                template<bool OtherConst>
+                bool operator==(Iterator<OtherConst> const& other) const { return _index == other._index; }
+
+            private:
+                template<bool> friend class Iterator;
+
+                Iterator(TablePtr table, std::size_t index) : _table(table), _index(index) { }
+
+                TablePtr _table = nullptr;
+                std::size_t _index = 0;
+            };
+
+            typedef Iterator<false> iterator;
+            typedef Iterator<true> const_iterator;
+
+            FlatHashTable() = default;
+
+            FlatHashTable(FlatHashTable const& other)
+            {
+                if (!other._size)
+                    return;
+
+                Allocate(other._capacity);
+                for (std::size_t i = 0; i < _capacity; ++i)
+                    if (other._states[i] == SLOT_FULL)
+                        ::new (static_cast<void*>(_slots + i)) Slot(other._slots[i]);
+
+                std::memcpy(_states.get(), other._states.get(), _capacity);
+                _size = other._size;
+                _used = other._used;
+            }
+
+            FlatHashTable(FlatHashTable&& other) noexcept { swap(other); }
+
+            FlatHashTable& operator=(FlatHashTable const& other)
+            {
+                if (this != &other)
+                {
+                    FlatHashTable copy(other);
+                    swap(copy);
+                }
+
+                return *this;
+            }
+
+            FlatHashTable& operator=(FlatHashTable&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    FlatHashTable moved(std::move(other));
+                    swap(moved);
+                }
+
+                return *this;
+            }
+
+            ~FlatHashTable()
+            {
+                DestroyAll();
+                Deallocate();
+            }
+
+            iterator begin() { return iterator(this, NextFull(0)); }
+            iterator end() { return iterator(this, _capacity); }
+            const_iterator begin() const { return const_iterator(this, NextFull(0)); }
+            const_iterator end() const { return const_iterator(this, _capacity); }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            [[nodiscard]] std::size_t size() const { return _size; }
+            [[nodiscard]] bool empty() const { return _size == 0; }
+
+            void clear()
+            {
+                DestroyAll();
+                if (_capacity)
+                    std::memset(_states.get(), SLOT_EMPTY, _capacity);
+
+                _size = 0;
+                _used = 0;
+            }
+
+            void reserve(std::size_t count)
+            {
+                if (count > MaxElements(_capacity))
+                    Rehash(CapacityFor(count));
+            }
+
+            iterator find(Key const& key) { return iterator(this, FindIndex(key)); }
+            const_iterator find(Key const& key) const { return const_iterator(this, FindIndex(key)); }
+            [[nodiscard]] bool contains(Key const& key) const { return FindIndex(key) != _capacity; }
+            [[nodiscard]] std::size_t count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+            std::size_t erase(Key const& key)
+            {
+                std::size_t index = FindIndex(key);
+                if (index == _capacity)
+                    return 0;
+
+                EraseIndex(index);
+                return 1;
+            }
+
+            iterator erase(const_iterator itr)
+            {
+                EraseIndex(itr._index);
+                return iterator(this, NextFull(itr._index + 1));
+            }
+
+            void swap(FlatHashTable& other) noexcept
+            {
+                std::swap(_slots, other._slots);
+                std::swap(_states, other._states);
+                std::swap(_capacity, other._capacity);
+                std::swap(_shift, other._shift);
+                std::swap(_size, other._size);
+                std::swap(_used, other._used);
+            }
+
+        protected:
+            /// Constructs the element with construct(Slot*) unless the key is already present.
+            template<typename Construct>
+            std::pair<iterator, bool> InsertUnique(Key const& key, Construct&& construct)
+            {
+                std::size_t index = FindIndex(key);
+                if (index != _capacity)
+                    return { iterator(this, index), false };
+
+                if (_used + 1 > MaxElements(_capacity))
+                    Rehash(CapacityFor(_size + 1));
+
+                index = FindFreeIndex(key);
+                construct(_slots + index);
+                if (_states[index] == SLOT_EMPTY)
+                    ++_used;
+
+                _states[index] = SLOT_FULL;
+                ++_size;
+                return { iterator(this, index), true };
+            }
+
+        private:
+            static std::size_t MaxElements(std::size_t capacity) { return capacity - capacity / 8; }
+
+            static std::size_t CapacityFor(std::size_t count)
+            {
+                std::size_t capacity = MinCapacity;
+                while (MaxElements(capacity) < count * 2 && capacity < (std::size_t(1) << 62))
+                    capacity *= 2;
+
+                return capacity;
+            }
+
+            std::size_t GetHomeIndex(Key const& key) const
+            {
+                uint64 hash = uint64(Hash()(key)) * UI64LIT(0x9E3779B97F4A7C15);
+                return std::size_t(hash >> _shift);
+            }
+
+            std::size_t FindIndex(Key const& key) const
+            {
+                if (!_size)
+                    return _capacity;
+
+                std::size_t mask = _capacity - 1;
+                for (std::size_t index = GetHomeIndex(key); ; index = (index + 1) & mask)
+                {
+                    if (_states[index] == SLOT_EMPTY)
+                        return _capacity;
+
+                    if (_states[index] == SLOT_FULL && KeyEqual()(KeyOf()(_slots[index]), key))
+                        return index;
+                }
+            }
+
+            std::size_t FindFreeIndex(Key const& key) const
+            {
+                std::size_t mask = _capacity - 1;
+                std::size_t index = GetHomeIndex(key);
+                while (_states[index] == SLOT_FULL)
+                    index = (index + 1) & mask;
+
+                return index;
+            }
+
+            std::size_t NextFull(std::size_t index) const
+            {
+                while (index < _capacity && _states[index] != SLOT_FULL)
+                    ++index;
+
+                return index;
+            }
+
+            void EraseIndex(std::size_t index)
+            {
+                _slots[index].~Slot();
+                --_size;
+
+                // a probe sequence never continues past an empty slot, so this one does not need a tombstone
+                if (_states[(index + 1) & (_capacity - 1)] == SLOT_EMPTY)
+                {
+                    _states[index] = SLOT_EMPTY;
+                    --_used;
+                }
+                else
+                    _states[index] = SLOT_DELETED;
+            }
+
+            void Allocate(std::size_t capacity)
+            {
+                _slots = std::allocator<Slot>().allocate(capacity);
+                _states = std::make_unique<uint8[]>(capacity);
+                _capacity = capacity;
+                _shift = 64 - std::countr_zero(uint64(capacity));
+            }
+
+            void Deallocate()
+            {
+                if (_slots)
+                    std::allocator<Slot>().deallocate(_slots, _capacity);
+
+                _slots = nullptr;
+                _states.reset();
+                _capacity = 0;
+            }
+
+            void DestroyAll()
+            {
+                if constexpr (!std::is_trivially_destructible_v<Slot>)
+                    for (std::size_t i = 0; i < _capacity; ++i)
+                        if (_states[i] == SLOT_FULL)
+                            _slots[i].~Slot();
+            }
+
+            void Rehash(std::size_t capacity)
+            {
+                FlatHashTable rehashed;
+                rehashed.Allocate(capacity);
+                for (std::size_t i = 0; i < _capacity; ++i)
+                {
+                    if (_states[i] != SLOT_FULL)
+                        continue;
+
+                    std::size_t index = rehashed.FindFreeIndex(KeyOf()(_slots[i]));
+                    ::new (static_cast<void*>(rehashed._slots + index)) Slot(std::move(_slots[i]));
+                    rehashed._states[index] = SLOT_FULL;
+                }
+
+                rehashed._size = rehashed._used = _size;
+                swap(rehashed);
+            }
+
+            Slot* _slots = nullptr;
+            std::unique_ptr<uint8[]> _states;
+            std::size_t _capacity = 0;
+            int _shift = 64;
+            std::size_t _size = 0;
+            std::size_t _used = 0;     // full slots and tombstones
+        };
+
+        template<typename Key, typename Value>
+        struct PairKeyOf
+        {
+            Key const& operator()(std::pair<Key const, Value> const& slot) const { return slot.first; }
+        };
+
+        template<typename Key>
+        struct IdentityKeyOf
+        {
+            Key const& operator()(Key const& slot) const { return slot; }
+        };
+    }
+
+    /// Flat replacement for std::unordered_map, see Impl::FlatHashTable for the invalidation rules.
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class FlatHashMap : public Impl::FlatHashTable<Key, std::pair<Key const, Value>, Impl::PairKeyOf<Key, Value>, Hash, KeyEqual>
+    {
+        typedef Impl::FlatHashTable<Key, std::pair<Key const, Value>, Impl::PairKeyOf<Key, Value>, Hash, KeyEqual> Base;
+
+    public:
+        typedef Key key_type;
+        typedef Value mapped_type;
+        typedef std::pair<Key const, Value> value_type;
+        typedef typename Base::iterator iterator;
+        typedef typename Base::const_iterator const_iterator;
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(Key const& key, Args&&... args)
+        {
+            return this->InsertUnique(key, [&](value_type* slot)
+            {
+                ::new (static_cast<void*>(slot)) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            });
+        }
+
+        template<typename V>
+        std::pair<iterator, bool> emplace(Key const& key, V&& value) { return try_emplace(key, std::forward<V>(value)); }
+
+        std::pair<iterator, bool> insert(value_type const& value) { return try_emplace(value.first, value.second); }
+
+        Value& operator[](Key const& key) { return try_emplace(key).first->second; }
+
+        Value& at(Key const& key)
+        {
+            auto itr = this->find(key);
+            if (itr == this->end())
+                throw std::out_of_range("Acore::FlatHashMap::at: key not found");
+
+            return itr->second;
+        }
+
+        Value const& at(Key const& key) const
+        {
+            auto itr = this->find(key);
+            if (itr == this->end())
+                throw std::out_of_range("Acore::FlatHashMap::at: key not found");
+
+            return itr->second;
+        }
+    };
+
+    /// Flat replacement for std::unordered_set, see Impl::FlatHashTable for the invalidation rules.
+    template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class FlatHashSet : public Impl::FlatHashTable<Key, Key, Impl::IdentityKeyOf<Key>, Hash, KeyEqual>
+    {
+        typedef Impl::FlatHashTable<Key, Key, Impl::IdentityKeyOf<Key>, Hash, KeyEqual> Base;
+
+    public:
+        typedef Key key_type;
+        typedef Key value_type;
+        // elements are keys and must not be modified in place
+        typedef typename Base::const_iterator iterator;
+        typedef typename Base::const_iterator const_iterator;
+
+        const_iterator begin() const { return Base::begin(); }
+        const_iterator end() const { return Base::end(); }
+
+        const_iterator find(Key const& key) const { return Base::find(key); }
+
+        std::pair<const_iterator, bool> insert(Key const& key)
+        {
+            auto [itr, inserted] = this->InsertUnique(key, [&](Key* slot) { ::new (static_cast<void*>(slot)) Key(key); });
+            return { itr, inserted };
+        }
+
+        std::pair<const_iterator, bool> emplace(Key const& key) { return insert(key); }
+    };
+}
+
+#endif // _FLAT_HASH_MAP_H
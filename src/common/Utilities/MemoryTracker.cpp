@@ -0,0 +1,211 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MemoryTracker.h"
+#include <array>
+
+#ifdef ACORE_MEMORY_TRACKING
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    constexpr std::size_t TagCount = std::size_t(MemoryTag::Max);
+    constexpr uint32 FlushInterval = 64;
+
+    /// Stored in front of every allocation, so frees are accounted to the tag of the allocation
+    struct alignas(16) AllocationHeader
+    {
+        std::size_t Size;
+        uint32 Offset;      // from the start of the underlying block to the user pointer
+        MemoryTag Tag;
+    };
+
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    std::array<std::atomic<int64>, TagCount> Bytes;
+    std::array<std::atomic<int64>, TagCount> Allocations;
+
+    // trivial thread locals only, these are used from inside operator new
+    thread_local MemoryTag CurrentTag = MemoryTag::Other;
+    thread_local std::array<int64, TagCount> PendingBytes;
+    thread_local std::array<int64, TagCount> PendingAllocations;
+    thread_local uint32 PendingOperations = 0;
+
+    void Flush()
+    {
+        for (std::size_t tag = 0; tag < TagCount; ++tag)
+        {
+            if (PendingBytes[tag])
+                Bytes[tag].fetch_add(PendingBytes[tag], std::memory_order_relaxed);
+
+            if (PendingAllocations[tag])
+                Allocations[tag].fetch_add(PendingAllocations[tag], std::memory_order_relaxed);
+        }
+
+        PendingBytes.fill(0);
+        PendingAllocations.fill(0);
+        PendingOperations = 0;
+    }
+
+    void Account(MemoryTag tag, int64 bytes, int64 allocations)
+    {
+        PendingBytes[std::size_t(tag)] += bytes;
+        PendingAllocations[std::size_t(tag)] += allocations;
+        if (++PendingOperations >= FlushInterval)
+            Flush();
+    }
+
+    void* AllocateBlock(std::size_t size, std::size_t alignment)
+    {
+        std::size_t offset = alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader);
+        if (size > std::size_t(-1) - offset * 2)
+            return nullptr;
+
+        char* block;
+        if (alignment > alignof(std::max_align_t))
+            block = static_cast<char*>(std::aligned_alloc(alignment, (size + offset + alignment - 1) / alignment * alignment));
+        else
+            block = static_cast<char*>(std::malloc(size + offset));
+
+        if (!block)
+            return nullptr;
+
+        MemoryTag tag = CurrentTag;
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(block + offset) - 1;
+        header->Size = size;
+        header->Offset = uint32(offset);
+        header->Tag = tag;
+
+        Account(tag, int64(size), 1);
+        return block + offset;
+    }
+
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        for (;;)
+        {
+            if (void* ptr = AllocateBlock(size, alignment))
+                return ptr;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+
+            handler();
+        }
+    }
+
+    void* AllocateNoThrow(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        try
+        {
+            return Allocate(size, alignment);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    void Deallocate(void* ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+        Account(header->Tag, -int64(header->Size), -1);
+        std::free(static_cast<char*>(ptr) - header->Offset);
+    }
+}
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept { return AllocateNoThrow(size); }
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept { return AllocateNoThrow(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return Allocate(size, std::size_t(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return Allocate(size, std::size_t(alignment)); }
+void* operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return AllocateNoThrow(size, std::size_t(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return AllocateNoThrow(size, std::size_t(alignment)); }
+
+void operator delete(void* ptr) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { Deallocate(ptr); }
+
+Acore::MemoryTagScope::MemoryTagScope(MemoryTag tag) : _previousTag(CurrentTag)
+{
+    CurrentTag = tag;
+}
+
+Acore::MemoryTagScope::~MemoryTagScope()
+{
+    CurrentTag = _previousTag;
+}
+
+bool Acore::MemoryTracker::IsEnabled()
+{
+    return true;
+}
+
+Acore::MemoryTracker::Statistics Acore::MemoryTracker::GetStatistics(MemoryTag tag)
+{
+    Statistics statistics;
+    int64 bytes = Bytes[std::size_t(tag)].load(std::memory_order_relaxed);
+    int64 allocations = Allocations[std::size_t(tag)].load(std::memory_order_relaxed);
+
+    // a thread may free what another one allocated before both flushed their counters
+    statistics.Bytes = bytes > 0 ? uint64(bytes) : 0;
+    statistics.Allocations = allocations > 0 ? uint64(allocations) : 0;
+    return statistics;
+}
+#else
+bool Acore::MemoryTracker::IsEnabled()
+{
+    return false;
+}
+
+Acore::MemoryTracker::Statistics Acore::MemoryTracker::GetStatistics(MemoryTag /*tag*/)
+{
+    return Statistics();
+}
+#endif
+
+char const* Acore::MemoryTracker::GetTagName(MemoryTag tag)
+{
+    static constexpr std::array<char const*, std::size_t(MemoryTag::Max)> TagNames =
+    {
+        "other",
+        "map",
+        "world_session",
+        "object_mgr",
+        "database",
+        "loot"
+    };
+
+    return tag < MemoryTag::Max ? TagNames[std::size_t(tag)] : "unknown";
+}
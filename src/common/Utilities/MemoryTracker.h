@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MEMORY_TRACKER_H
+#define _MEMORY_TRACKER_H
+
+#include "Define.h"
+
+enum class MemoryTag : uint8
+{
+    Other,
+    Map,
+    WorldSession,
+    ObjectMgr,
+    Database,
+    Loot,
+
+    Max
+};
+
+namespace Acore
+{
+    /**
+     * Accounts the heap memory allocated by the current thread to a subsystem while the scope is alive.
+     *
+     * Memory stays accounted to the tag it was allocated under until it is freed, on any thread.
+     * Scopes nest, the innermost one wins. Accounting needs the global operator new and delete
+     * replacements of a WITH_MEMORY_TRACKING build, otherwise scopes compile to nothing.
+     */
+    class AC_COMMON_API MemoryTagScope
+    {
+    public:
+#ifdef ACORE_MEMORY_TRACKING
+        explicit MemoryTagScope(MemoryTag tag);
+        ~MemoryTagScope();
+#else
+        explicit MemoryTagScope(MemoryTag /*tag*/) { }
+#endif
+
+        MemoryTagScope(MemoryTagScope const&) = delete;
+        MemoryTagScope& operator=(MemoryTagScope const&) = delete;
+
+#ifdef ACORE_MEMORY_TRACKING
+    private:
+        MemoryTag _previousTag;
+#endif
+    };
+
+    namespace MemoryTracker
+    {
+        struct Statistics
+        {
+            uint64 Bytes = 0;           // requested bytes still allocated, without allocator overhead
+            uint64 Allocations = 0;     // allocations not freed yet
+        };
+
+        AC_COMMON_API bool IsEnabled();
+
+        AC_COMMON_API char const* GetTagName(MemoryTag tag);
+
+        /// Counters are flushed from the threads in batches, recent operations may not be included yet.
+        AC_COMMON_API Statistics GetStatistics(MemoryTag tag);
+    }
+}
+
+#endif // _MEMORY_TRACKER_H
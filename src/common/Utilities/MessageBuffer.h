@@ -18,15 +18,17 @@
 #ifndef __MESSAGEBUFFER_H_
 #define __MESSAGEBUFFER_H_
 
+#include "BufferAllocator.h"
 #include "Define.h"
 #include <cstring>
 #include <vector>
 
 class MessageBuffer
 {
-    using size_type = std::vector<uint8>::size_type;
-
 public:
+    using StorageType = std::vector<uint8, Acore::BufferAllocator<uint8>>;
+    using size_type = StorageType::size_type;
+
     MessageBuffer() :  _storage()
     {
         _storage.resize(4096);
@@ -99,7 +101,7 @@ public:
         }
     }
 
-    std::vector<uint8>&& Move()
+    StorageType&& Move()
     {
         _wpos = 0;
         _rpos = 0;
@@ -134,7 +136,7 @@ public:
 private:
     size_type _wpos{0};
     size_type _rpos{0};
-    std::vector<uint8> _storage;
+    StorageType _storage;
 };
 
 #endif /* __MESSAGEBUFFER_H_ */
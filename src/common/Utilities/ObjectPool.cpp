@@ -0,0 +1,311 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "Errors.h"
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+namespace
+{
+    using Acore::ObjectPool;
+
+    constexpr std::size_t MaxThreadBytesPerList = 256 * 1024;
+    constexpr std::size_t MaxDepotBatches = 8;
+    constexpr uint32 StatisticsFlushInterval = 256;
+
+    std::size_t GetMaxThreadBlocks(std::size_t size)
+    {
+        return std::clamp<std::size_t>(MaxThreadBytesPerList / size, 4, 64);
+    }
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* Head = nullptr;
+        std::size_t Count = 0;
+
+        void Push(void* ptr)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = Head;
+            Head = block;
+            ++Count;
+        }
+
+        void* Pop()
+        {
+            FreeBlock* block = Head;
+            Head = block->Next;
+            --Count;
+            return block;
+        }
+
+        void Release()
+        {
+            while (Head)
+                ::operator delete(Pop());
+        }
+    };
+
+    /// Batches of blocks handed over between threads
+    struct Depot
+    {
+        ~Depot()
+        {
+            for (FreeList& batch : Batches)
+                batch.Release();
+        }
+
+        std::mutex Lock;
+        std::vector<FreeList> Batches;
+    };
+
+    struct PoolCounters
+    {
+        std::atomic<uint64> PoolAllocations{0};
+        std::atomic<uint64> HeapAllocations{0};
+        std::atomic<uint64> Deallocations{0};
+    };
+
+    std::array<std::atomic<ObjectPool const*>, ObjectPool::MaxPools> Pools;
+    std::atomic<std::size_t> PoolCount{0};
+    std::array<PoolCounters, ObjectPool::MaxPools> Counters;
+    std::array<std::array<Depot, ObjectPool::MaxBlockSizes>, ObjectPool::MaxPools> Depots;
+
+    void PushToDepot(std::size_t pool, std::size_t slot, FreeList& batch)
+    {
+        {
+            Depot& depot = Depots[pool][slot];
+            std::lock_guard<std::mutex> lock(depot.Lock);
+            if (depot.Batches.size() < MaxDepotBatches)
+            {
+                depot.Batches.push_back(batch);
+                batch = FreeList();
+                return;
+            }
+        }
+
+        batch.Release();
+    }
+
+    bool PopFromDepot(std::size_t pool, std::size_t slot, FreeList& list)
+    {
+        Depot& depot = Depots[pool][slot];
+        std::lock_guard<std::mutex> lock(depot.Lock);
+        if (depot.Batches.empty())
+            return false;
+
+        list = depot.Batches.back();
+        depot.Batches.pop_back();
+        return true;
+    }
+
+    class ThreadCache
+    {
+    public:
+        ~ThreadCache();
+
+        void* Allocate(std::size_t pool, std::size_t slot, std::size_t size);
+        void Deallocate(void* ptr, std::size_t pool, std::size_t slot, std::size_t size);
+
+        void CountHeapAllocation(std::size_t pool);
+        void CountDeallocation(std::size_t pool);
+
+    private:
+        struct PendingCounters
+        {
+            uint64 PoolAllocations = 0;
+            uint64 HeapAllocations = 0;
+            uint64 Deallocations = 0;
+        };
+
+        void CountOperation();
+        void FlushStatistics();
+
+        std::array<std::array<FreeList, ObjectPool::MaxBlockSizes>, ObjectPool::MaxPools> _lists;
+        std::array<PendingCounters, ObjectPool::MaxPools> _counters;
+        uint32 _pendingOperations = 0;
+    };
+
+    thread_local ThreadCache Cache;
+    thread_local bool CacheDestroyed = false;   // objects freed during thread teardown bypass the pool
+
+    ThreadCache::~ThreadCache()
+    {
+        CacheDestroyed = true;
+
+        for (std::size_t pool = 0; pool < ObjectPool::MaxPools; ++pool)
+            for (std::size_t slot = 0; slot < ObjectPool::MaxBlockSizes; ++slot)
+                if (_lists[pool][slot].Head)
+                    PushToDepot(pool, slot, _lists[pool][slot]);
+
+        FlushStatistics();
+    }
+
+    void* ThreadCache::Allocate(std::size_t pool, std::size_t slot, std::size_t size)
+    {
+        FreeList& list = _lists[pool][slot];
+        if (!list.Head && !PopFromDepot(pool, slot, list))
+        {
+            CountHeapAllocation(pool);
+            return ::operator new(size);
+        }
+
+        ++_counters[pool].PoolAllocations;
+        CountOperation();
+        return list.Pop();
+    }
+
+    void ThreadCache::Deallocate(void* ptr, std::size_t pool, std::size_t slot, std::size_t size)
+    {
+        CountDeallocation(pool);
+
+        FreeList& list = _lists[pool][slot];
+        list.Push(ptr);
+
+        std::size_t maxBlocks = GetMaxThreadBlocks(size);
+        if (list.Count <= maxBlocks)
+            return;
+
+        // hand half of the blocks to threads that allocate more than they free
+        FreeList batch;
+        while (batch.Count < maxBlocks / 2)
+            batch.Push(list.Pop());
+
+        PushToDepot(pool, slot, batch);
+    }
+
+    void ThreadCache::CountHeapAllocation(std::size_t pool)
+    {
+        ++_counters[pool].HeapAllocations;
+        CountOperation();
+    }
+
+    void ThreadCache::CountDeallocation(std::size_t pool)
+    {
+        ++_counters[pool].Deallocations;
+        CountOperation();
+    }
+
+    void ThreadCache::CountOperation()
+    {
+        if (++_pendingOperations >= StatisticsFlushInterval)
+            FlushStatistics();
+    }
+
+    void ThreadCache::FlushStatistics()
+    {
+        for (std::size_t pool = 0; pool < ObjectPool::MaxPools; ++pool)
+        {
+            PendingCounters& pending = _counters[pool];
+            Counters[pool].PoolAllocations.fetch_add(pending.PoolAllocations, std::memory_order_relaxed);
+            Counters[pool].HeapAllocations.fetch_add(pending.HeapAllocations, std::memory_order_relaxed);
+            Counters[pool].Deallocations.fetch_add(pending.Deallocations, std::memory_order_relaxed);
+            pending = PendingCounters();
+        }
+
+        _pendingOperations = 0;
+    }
+}
+
+Acore::ObjectPool::ObjectPool(char const* name) : _name(name), _id(PoolCount.fetch_add(1)), _blockSizes()
+{
+    ASSERT(_id < MaxPools, "Too many object pools, raise ObjectPool::MaxPools");
+    Pools[_id].store(this);
+}
+
+std::size_t Acore::ObjectPool::GetBlockSlot(std::size_t size)
+{
+    if (size > MaxPooledSize)
+        return MaxBlockSizes;
+
+    for (std::size_t slot = 0; slot < MaxBlockSizes; ++slot)
+    {
+        std::size_t blockSize = _blockSizes[slot].load(std::memory_order_relaxed);
+        if (!blockSize && _blockSizes[slot].compare_exchange_strong(blockSize, size, std::memory_order_relaxed))
+            return slot;
+
+        if (blockSize == size)
+            return slot;
+    }
+
+    return MaxBlockSizes;
+}
+
+void* Acore::ObjectPool::Allocate(std::size_t size)
+{
+    std::size_t slot = GetBlockSlot(size);
+    if (slot == MaxBlockSizes || CacheDestroyed)
+    {
+        if (!CacheDestroyed)
+            Cache.CountHeapAllocation(_id);
+
+        return ::operator new(size);
+    }
+
+    return Cache.Allocate(_id, slot, size);
+}
+
+void Acore::ObjectPool::Deallocate(void* ptr, std::size_t size)
+{
+    std::size_t slot = GetBlockSlot(size);
+    if (slot == MaxBlockSizes || CacheDestroyed)
+    {
+        if (!CacheDestroyed)
+            Cache.CountDeallocation(_id);
+
+        ::operator delete(ptr);
+        return;
+    }
+
+    Cache.Deallocate(ptr, _id, slot, size);
+}
+
+Acore::ObjectPool::Statistics Acore::ObjectPool::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.Name = _name;
+    statistics.PoolAllocations = Counters[_id].PoolAllocations.load(std::memory_order_relaxed);
+    statistics.HeapAllocations = Counters[_id].HeapAllocations.load(std::memory_order_relaxed);
+    statistics.Deallocations = Counters[_id].Deallocations.load(std::memory_order_relaxed);
+
+    for (Depot& depot : Depots[_id])
+    {
+        std::lock_guard<std::mutex> lock(depot.Lock);
+        for (FreeList const& batch : depot.Batches)
+            statistics.DepotBlocks += batch.Count;
+    }
+
+    return statistics;
+}
+
+std::vector<Acore::ObjectPool::Statistics> Acore::ObjectPool::GetAllStatistics()
+{
+    std::vector<Statistics> statistics;
+    std::size_t count = std::min(PoolCount.load(), MaxPools);
+    for (std::size_t id = 0; id < count; ++id)
+        if (ObjectPool const* pool = Pools[id].load())
+            statistics.push_back(pool->GetStatistics());
+
+    return statistics;
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECT_POOL_H
+#define _OBJECT_POOL_H
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Acore
+{
+    /**
+     * Recycles the storage of one family of frequently created and destroyed objects.
+     *
+     * A pool is a static object next to the class using it, which routes its class level
+     * operator new and delete here. Blocks of each object size (the class and its derived classes)
+     * are kept in per thread free lists, so map threads do not contend on the global heap. Objects
+     * freely move between maps and are often freed on another thread than the one that created
+     * them, so full thread lists hand batches of blocks to a shared depot. Blocks above the thread
+     * and depot limits are returned to the heap, which releases the memory of a destroyed instance.
+     */
+    class AC_COMMON_API ObjectPool
+    {
+    public:
+        static constexpr std::size_t MaxPools = 16;
+        static constexpr std::size_t MaxBlockSizes = 8;
+        static constexpr std::size_t MaxPooledSize = 32 * 1024;
+
+        struct Statistics
+        {
+            char const* Name = "";
+            uint64 PoolAllocations = 0;     // served from a thread list or the depot
+            uint64 HeapAllocations = 0;     // pool empty or size not pooled
+            uint64 Deallocations = 0;
+            uint64 DepotBlocks = 0;         // free blocks waiting in the depot
+
+            [[nodiscard]] uint64 GetLiveObjects() const
+            {
+                uint64 allocations = PoolAllocations + HeapAllocations;
+                return allocations > Deallocations ? allocations - Deallocations : 0;
+            }
+        };
+
+        explicit ObjectPool(char const* name);
+
+        ObjectPool(ObjectPool const&) = delete;
+        ObjectPool& operator=(ObjectPool const&) = delete;
+
+        void* Allocate(std::size_t size);
+        void Deallocate(void* ptr, std::size_t size);
+
+        /// Counters are flushed from the threads in batches, recent operations may not be included yet.
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        [[nodiscard]] static std::vector<Statistics> GetAllStatistics();
+
+    private:
+        std::size_t GetBlockSlot(std::size_t size);
+
+        char const* _name;
+        std::size_t _id;
+        std::array<std::atomic<std::size_t>, MaxBlockSizes> _blockSizes;   // 0 marks an unused slot
+    };
+}
+
+#endif // _OBJECT_POOL_H
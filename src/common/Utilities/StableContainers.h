@@ -0,0 +1,331 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STABLE_CONTAINERS_H
+#define _STABLE_CONTAINERS_H
+
+#include "Define.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Acore
+{
+    namespace Impl
+    {
+        template<typename Derived, typename SlotType, typename FilterType>
+        class StableSlots;
+
+        /**
+         * Iterator over the live slots of a StableVector or StableMultiMap.
+         *
+         * It is an index into the slot array, so it survives insertions (which append) and erasures (which only
+         * clear the slot) until the container is compacted. Cleared slots are skipped, slots appended while
+         * iterating are visited. An iterator of StableMultiMap::equal_range only stops on slots of its key.
+         */
+        template<typename Container, bool Const>
+        class StableIterator
+        {
+            friend Container;
+            template<typename, typename, typename> friend class StableSlots;
+            typedef std::conditional_t<Const, Container const*, Container*> ContainerPtr;
+            typedef typename Container::Slot Slot;
+            typedef typename Container::Filter Filter;
+
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Slot value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef std::conditional_t<Const, Slot const*, Slot*> pointer;
+            typedef std::conditional_t<Const, Slot const&, Slot&> reference;
+
+            StableIterator() = default;
+
+            template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            StableIterator(StableIterator<Container, OtherConst> const& other) : _container(other._container), _index(other._index), _filter(other._filter) { }
+
+            reference operator*() const { return _container->_slots[_index]; }
+            pointer operator->() const { return &_container->_slots[_index]; }
+
+            StableIterator& operator++()
+            {
+                if (_index != Container::End)
+                    _index = _container->Next(_index + 1, _filter);
+                return *this;
+            }
+
+            StableIterator operator++(int)
+            {
+                StableIterator itr = *this;
+                ++*this;
+                return itr;
+            }
+
+            StableIterator& operator--()
+            {
+                _index = _container->Prev(_index, _filter);
+                return *this;
+            }
+
+            StableIterator operator--(int)
+            {
+                StableIterator itr = *this;
+                --*this;
+                return itr;
+            }
+
+            template<bool OtherConst>
+            bool operator==(StableIterator<Container, OtherConst> const& other) const { return _index == other._index; }
+
+        private:
+            template<typename, bool> friend class StableIterator;
+
+            StableIterator(ContainerPtr container, std::size_t index, Filter const& filter) : _container(container), _index(index), _filter(filter) { }
+
+            ContainerPtr _container = nullptr;
+            std::size_t _index = Container::End;
+            Filter _filter = {};
+        };
+
+        /// Slot array shared by the stable containers, Derived tells live slots and the slots a filtered iterator stops on.
+        template<typename Derived, typename SlotType, typename FilterType>
+        class StableSlots
+        {
+            template<typename, bool> friend class StableIterator;
+
+        protected:
+            typedef SlotType Slot;
+            typedef FilterType Filter;
+
+            static constexpr std::size_t End = std::numeric_limits<std::size_t>::max();
+
+        public:
+            typedef StableIterator<Derived, false> iterator;
+            typedef StableIterator<Derived, true> const_iterator;
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+            typedef std::size_t size_type;
+
+            StableSlots() = default;
+
+            StableSlots(StableSlots const& other) : _size(other._size)
+            {
+                _slots.reserve(other._size);
+                std::copy_if(other._slots.begin(), other._slots.end(), std::back_inserter(_slots), &Derived::IsLive);
+            }
+
+            StableSlots(StableSlots&& other) noexcept : _slots(std::move(other._slots)), _size(std::exchange(other._size, 0))
+            {
+                other._slots.clear();
+            }
+
+            StableSlots& operator=(StableSlots const& other)
+            {
+                if (this != &other)
+                    *this = StableSlots(other);
+                return *this;
+            }
+
+            StableSlots& operator=(StableSlots&& other) noexcept
+            {
+                _slots = std::move(other._slots);
+                _size = std::exchange(other._size, 0);
+                other._slots.clear();
+                return *this;
+            }
+
+            iterator begin() { return iterator(Self(), Next(0, Filter()), Filter()); }
+            const_iterator begin() const { return const_iterator(Self(), Next(0, Filter()), Filter()); }
+            iterator end() { return iterator(Self(), End, Filter()); }
+            const_iterator end() const { return const_iterator(Self(), End, Filter()); }
+
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+            [[nodiscard]] size_type size() const { return _size; }
+            [[nodiscard]] bool empty() const { return !_size; }
+
+            void clear()
+            {
+                _slots.clear();
+                _size = 0;
+            }
+
+            /// Drops cleared slots, invalidates every iterator. Only call it where nothing iterates the container.
+            void Compact()
+            {
+                if (_slots.size() != _size)
+                    std::erase_if(_slots, [](Slot const& slot) { return !Derived::IsLive(slot); });
+            }
+
+        protected:
+            ~StableSlots() = default;
+
+            Derived* Self() { return static_cast<Derived*>(this); }
+            Derived const* Self() const { return static_cast<Derived const*>(this); }
+
+            /// First slot at or after index the filter stops on
+            std::size_t Next(std::size_t index, Filter const& filter) const
+            {
+                for (; index < _slots.size(); ++index)
+                    if (Derived::IsLive(_slots[index]) && Derived::Matches(_slots[index], filter))
+                        return index;
+
+                return End;
+            }
+
+            /// Last slot before index the filter stops on
+            std::size_t Prev(std::size_t index, Filter const& filter) const
+            {
+                for (index = std::min(index, _slots.size()); index-- > 0;)
+                    if (Derived::IsLive(_slots[index]) && Derived::Matches(_slots[index], filter))
+                        return index;
+
+                return End;
+            }
+
+            std::vector<Slot> _slots;
+            std::size_t _size = 0;
+        };
+
+        struct NoFilter { };
+    }
+
+    /**
+     * Vector of pointers with the iterator stability of std::list.
+     *
+     * Pointers are kept in insertion order next to each other. Erasing only clears the slot, so erasing while
+     * iterating is safe, and iterators are indices, so they survive a push_back. Cleared slots are reclaimed by
+     * Compact(), which the owner calls where nothing iterates the container.
+     */
+    template<typename T>
+    class StableVector : public Impl::StableSlots<StableVector<T>, T, Impl::NoFilter>
+    {
+        static_assert(std::is_pointer_v<T>, "StableVector stores pointers, a null slot is an erased element");
+
+        typedef Impl::StableSlots<StableVector<T>, T, Impl::NoFilter> Base;
+        friend Base;
+        template<typename, bool> friend class Impl::StableIterator;
+
+        static bool IsLive(T const& slot) { return slot != nullptr; }
+        static bool Matches(T const& /*slot*/, Impl::NoFilter const& /*filter*/) { return true; }
+
+    public:
+        typedef T value_type;
+
+        T const& front() const { return *this->begin(); }
+        T const& back() const { return *std::prev(this->end()); }
+
+        void push_back(T value)
+        {
+            this->_slots.push_back(value);
+            ++this->_size;
+        }
+
+        /// Erases every element equal to value
+        void remove(T value)
+        {
+            for (T& slot : this->_slots)
+            {
+                if (slot == value)
+                {
+                    slot = nullptr;
+                    --this->_size;
+                }
+            }
+        }
+
+        /// Stable sort like std::list::sort, compacts first and so invalidates every iterator
+        template<typename Compare>
+        void sort(Compare comp)
+        {
+            this->Compact();
+            std::stable_sort(this->_slots.begin(), this->_slots.end(), comp);
+        }
+    };
+
+    /**
+     * Unordered multimap of pointers with stable iterators, see StableVector.
+     *
+     * Lookups scan the slots, which beats a node based std::multimap for the few dozen elements it is meant for.
+     * Keys are not ordered: lower_bound and upper_bound delimit the elements of one key like equal_range does, and
+     * find returns an iterator over all elements that starts at the first element of the key.
+     */
+    template<typename Key, typename T>
+    class StableMultiMap : public Impl::StableSlots<StableMultiMap<Key, T>, std::pair<Key, T>, std::pair<Key, bool>>
+    {
+        static_assert(std::is_pointer_v<T>, "StableMultiMap maps to pointers, a null value is an erased element");
+
+        typedef Impl::StableSlots<StableMultiMap<Key, T>, std::pair<Key, T>, std::pair<Key, bool>> Base;
+        typedef typename Base::Slot Slot;
+        typedef typename Base::Filter Filter;
+        friend Base;
+        template<typename, bool> friend class Impl::StableIterator;
+
+        static bool IsLive(Slot const& slot) { return slot.second != nullptr; }
+        static bool Matches(Slot const& slot, Filter const& filter) { return !filter.second || slot.first == filter.first; }
+
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef typename Base::iterator iterator;
+        typedef typename Base::const_iterator const_iterator;
+        typedef typename Base::size_type size_type;
+
+        iterator insert(value_type const& value)
+        {
+            this->_slots.push_back(value);
+            ++this->_size;
+            return iterator(this, this->_slots.size() - 1, Filter());
+        }
+
+        /// Clears the slot of itr and returns the next element itr would stop on
+        iterator erase(iterator itr)
+        {
+            iterator next = itr;
+            ++next;
+            this->_slots[itr._index].second = nullptr;
+            --this->_size;
+            return next;
+        }
+
+        iterator find(Key const& key) { return iterator(this, this->Next(0, Filter(key, true)), Filter()); }
+        const_iterator find(Key const& key) const { return const_iterator(this, this->Next(0, Filter(key, true)), Filter()); }
+
+        [[nodiscard]] size_type count(Key const& key) const
+        {
+            return std::count_if(this->_slots.begin(), this->_slots.end(), [&key](Slot const& slot) { return IsLive(slot) && slot.first == key; });
+        }
+
+        iterator lower_bound(Key const& key) { return iterator(this, this->Next(0, Filter(key, true)), Filter(key, true)); }
+        const_iterator lower_bound(Key const& key) const { return const_iterator(this, this->Next(0, Filter(key, true)), Filter(key, true)); }
+        iterator upper_bound(Key const& key) { return iterator(this, Base::End, Filter(key, true)); }
+        const_iterator upper_bound(Key const& key) const { return const_iterator(this, Base::End, Filter(key, true)); }
+
+        std::pair<iterator, iterator> equal_range(Key const& key) { return { lower_bound(key), upper_bound(key) }; }
+        std::pair<const_iterator, const_iterator> equal_range(Key const& key) const { return { lower_bound(key), upper_bound(key) }; }
+    };
+}
+
+#endif // _STABLE_CONTAINERS_H
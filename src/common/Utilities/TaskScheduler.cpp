@@ -17,6 +17,7 @@
 
 #include "TaskScheduler.h"
 #include "Errors.h"
+#include <algorithm>
 
 TaskScheduler& TaskScheduler::ClearValidator()
 {
@@ -131,19 +132,25 @@ Milliseconds TaskScheduler::GetNextGroupOccurrence(group_t const group) const
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.insert(task);
+    // insert in front of tasks with the same end so those are executed first
+    auto itr = std::lower_bound(container.begin(), container.end(), task, [](TaskContainer const& left, TaskContainer const& right)
+    {
+        return *right < *left;
+    });
+
+    container.insert(itr, std::move(task));
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.back();
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -153,32 +160,28 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    container.erase(std::remove_if(container.begin(), container.end(), filter), container.end());
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
+    std::vector<TaskContainer> remaining;
     std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
+    remaining.reserve(container.size());
+
+    for (TaskContainer& task : container)
+    {
+        if (filter(task))
+            cache.push_back(std::move(task));
         else
-        {
-            ++itr;
-        }
+            remaining.push_back(std::move(task));
+    }
+
+    container.swap(remaining);
 
-    container.insert(cache.begin(), cache.end());
+    // reinsert in execution order so modified tasks keep their relative order
+    for (auto itr = cache.rbegin(); itr != cache.rend(); ++itr)
+        Push(std::move(*itr));
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
@@ -23,7 +23,6 @@
 #include <functional>
 #include <optional>
 #include <queue>
-#include <set>
 #include <vector>
 
 class TaskContext;
@@ -118,17 +117,11 @@ class TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        };
-    };
-
     class TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        /// Sorted by descending end so the next task is at the back,
+        /// tasks with the same end keep their insertion order.
+        std::vector<TaskContainer> container;
 
     public:
         // Pushes the task in the container
@@ -387,7 +380,7 @@ private:
     TaskScheduler& ScheduleAt(timepoint_t const& end,
                               std::chrono::duration<_Rep, _Period> const& time, task_handler_t const& task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(std::make_shared<Task>(end + time, time, task));
     }
 
     /// Schedule an event with a fixed rate.
@@ -398,7 +391,7 @@ private:
                               group_t const group, task_handler_t const& task)
     {
         static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(std::make_shared<Task>(end + time, time, group, DEFAULT_REPEATED, task));
     }
 
     // Returns a random duration between min and max
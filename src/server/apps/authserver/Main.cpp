@@ -24,6 +24,7 @@
 */
 
 #include "AppenderDB.h"
+#include "AuthCryptoPool.h"
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Config.h"
@@ -36,6 +37,7 @@
 #include "OpenSSLCrypto.h"
 #include "ProcessPriority.h"
 #include "RealmList.h"
+#include "RealmListCache.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
 #include "SteadyTimer.h"
@@ -135,6 +137,8 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> sRealmListHandle(nullptr, [](void*) { sRealmList->Close(); });
 
+    sRealmListCache->Initialize(Seconds(sConfigMgr->GetOption<int32>("RealmsCharacterCountsCacheTime", 5)));
+
     if (sRealmList->GetRealms().empty())
     {
         LOG_ERROR("server.authserver", "No valid realms specified.");
@@ -158,6 +162,11 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // Start the worker threads handling the SRP6 math of logon handshakes
+    sAuthCryptoPool->Start(sConfigMgr->GetOption<int32>("CryptoThreads", 2));
+
+    std::shared_ptr<void> sAuthCryptoPoolHandle(nullptr, [](void*) { sAuthCryptoPool->Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -261,8 +270,8 @@ void BanExpiryHandler(std::weak_ptr<boost::asio::steady_timer> banExpiryCheckTim
     {
         if (std::shared_ptr<boost::asio::steady_timer> banExpiryCheckTimer = banExpiryCheckTimerRef.lock())
         {
-            LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_DEL_EXPIRED_IP_BANS));
-            LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_EXPIRED_ACCOUNT_BANS));
+            LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_DEL_EXPIRED_IP_BANS), SQL_OPERATION_PRIORITY_BACKGROUND);
+            LoginDatabase.Execute(LoginDatabase.GetPreparedStatement(LOGIN_UPD_EXPIRED_ACCOUNT_BANS), SQL_OPERATION_PRIORITY_BACKGROUND);
 
             banExpiryCheckTimer->expires_at(Acore::Asio::SteadyTimer::GetExpirationTime(banExpiryCheckInterval));
             banExpiryCheckTimer->async_wait(std::bind(&BanExpiryHandler, banExpiryCheckTimerRef, banExpiryCheckInterval, std::placeholders::_1));
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef AuthCryptoPool_h__
+#define AuthCryptoPool_h__
+
+#include "Define.h"
+#include "Duration.h"
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+/// Runs the expensive SRP6 math of the logon handshake outside of the network thread.
+/// Results are handed back as futures and picked up by AuthSession::Update, like async query results.
+class AuthCryptoPool
+{
+public:
+    static AuthCryptoPool* instance();
+
+    /// Starts the worker threads, with 0 threads tasks are executed inline
+    void Start(uint32 threadCount);
+    void Stop();
+
+    template<typename Task>
+    std::shared_future<std::invoke_result_t<Task>> Enqueue(Task&& task)
+    {
+        auto packagedTask = std::make_shared<std::packaged_task<std::invoke_result_t<Task>()>>(std::forward<Task>(task));
+        std::shared_future<std::invoke_result_t<Task>> result = packagedTask->get_future().share();
+
+        if (_pool)
+            boost::asio::post(*_pool, [packagedTask]() { (*packagedTask)(); });
+        else
+            (*packagedTask)();
+
+        return result;
+    }
+
+private:
+    AuthCryptoPool() = default;
+    ~AuthCryptoPool();
+
+    std::unique_ptr<boost::asio::thread_pool> _pool;
+};
+
+/// Pending AuthCryptoPool result and the session handler continuing with it
+class AuthCryptoCallback
+{
+public:
+    template<typename T>
+    AuthCryptoCallback(std::shared_future<T> result, std::function<void(std::type_identity_t<T>)>&& callback)
+        : _invokeIfReady([result, callback = std::move(callback)]()
+        {
+            if (result.wait_for(0s) != std::future_status::ready)
+                return false;
+
+            callback(result.get());
+            return true;
+        }) { }
+
+    bool InvokeIfReady() { return _invokeIfReady(); }
+
+private:
+    std::function<bool()> _invokeIfReady;
+};
+
+#define sAuthCryptoPool AuthCryptoPool::instance()
+
+#endif // AuthCryptoPool_h__
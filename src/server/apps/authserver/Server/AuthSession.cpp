@@ -26,6 +26,7 @@
 #include "IPLocation.h"
 #include "Log.h"
 #include "RealmList.h"
+#include "RealmListCache.h"
 #include "SecretMgr.h"
 #include "StringConvert.h"
 #include "TOTP.h"
@@ -182,6 +183,7 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -405,9 +407,21 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
-        fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>());
+    // Generating the server ephemeral key is expensive, do it outside of the network thread
+    _cryptoProcessor.AddCallback(AuthCryptoCallback(sAuthCryptoPool->Enqueue(
+        [login = _accountInfo.Login, salt = fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(), verifier = fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>()]()
+        {
+            return std::make_shared<Acore::Crypto::SRP6>(login, salt, verifier);
+        }), std::bind(&AuthSession::LogonChallengeSRP6Callback, this, securityFlags, std::placeholders::_1)));
+}
+
+void AuthSession::LogonChallengeSRP6Callback(uint8 securityFlags, std::shared_ptr<Acore::Crypto::SRP6> srp6)
+{
+    _srp6 = std::move(srp6);
+
+    ByteBuffer pkt;
+    pkt << uint8(AUTH_LOGON_CHALLENGE);
+    pkt << uint8(0x00);
 
     // Fill the response packet with the result
     if (AuthHelper::IsAcceptedClientBuild(_build))
@@ -442,7 +456,7 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
             pkt << uint8(1);
 
         LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
 
         _status = STATUS_LOGON_PROOF;
     }
@@ -469,21 +483,46 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
+    // The read buffer is consumed once this handler returns, keep what the proof callback needs
+    Optional<std::string> token;
+    if ((logonProof->securityFlags & 0x04) && _totpSecret)
+    {
+        // the token follows the proof, the packet size check in ReadHandler only covers the proof
+        if (GetReadBuffer().GetActiveSize() < sizeof(sAuthLogonProof_C) + sizeof(uint8))
+            return false;
+
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        if (GetReadBuffer().GetActiveSize() < sizeof(sAuthLogonProof_C) + sizeof(size) + size)
+            return false;
+
+        token.emplace(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+    }
+
+    // Verifying the client proof is expensive, do it outside of the network thread
+    _cryptoProcessor.AddCallback(AuthCryptoCallback(sAuthCryptoPool->Enqueue(
+        [srp6 = _srp6, A = logonProof->A, clientM = logonProof->clientM]()
+        {
+            return srp6->VerifyChallengeResponse(A, clientM);
+        }), std::bind(&AuthSession::LogonProofCallback, this, *logonProof, std::move(token), std::placeholders::_1)));
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(sAuthLogonProof_C const& logonProof, Optional<std::string> const& token, Optional<SessionKey> K)
+{
     // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    if (K)
     {
         _sessionKey = *K;
         // Check auth token
         bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
+        bool sentToken = (logonProof.securityFlags & 0x04);
         if (sentToken && _totpSecret)
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
+            if (Optional<uint32> incomingToken = token ? Acore::StringTo<uint32>(*token) : std::nullopt)
+                tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, *incomingToken);
 
-            uint32 incomingToken = *Acore::StringTo<uint32>(token);
-            tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
             memset(_totpSecret->data(), 0, _totpSecret->size());
         }
         else if (!sentToken && !_totpSecret)
@@ -496,16 +535,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(logonProof.A.data(), logonProof.A.size(), logonProof.crc_hash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -523,7 +562,7 @@ bool AuthSession::HandleLogonProof()
         LoginDatabase.DirectExecute(stmt);
 
         // Finish SRP6 and send the final result to the client
-        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof.A, logonProof.clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -613,8 +652,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
@@ -727,6 +764,12 @@ bool AuthSession::HandleRealmList()
 {
     LOG_DEBUG("server.authserver", "Entering _HandleRealmList");
 
+    if (Optional<std::map<uint32, uint8>> characterCounts = sRealmListCache->GetCharacterCounts(_accountInfo.Id))
+    {
+        SendRealmList(*characterCounts);
+        return true;
+    }
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTER_COUNTS);
     stmt->SetData(0, _accountInfo.Id);
 
@@ -747,62 +790,32 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
         } while (result->NextRow());
     }
 
-    // Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
-    ByteBuffer pkt;
-
-    std::size_t RealmListSize = 0;
-    for (auto const& [realmHandle, realm] : sRealmList->GetRealms())
-    {
-        // don't work with realms which not compatible with the client
-        bool okBuild = ((_expversion & POST_BC_EXP_FLAG) && realm.Build == _build) || ((_expversion & PRE_BC_EXP_FLAG) && !AuthHelper::IsPreBCAcceptedClientBuild(realm.Build));
-
-        // No SQL injection. id of realm is controlled by the database.
-        uint32 flag = realm.Flags;
-        RealmBuildInfo const* buildInfo = sRealmList->GetBuildInfo(realm.Build);
-        if (!okBuild)
-        {
-            if (!buildInfo)
-                continue;
-
-            flag |= REALM_FLAG_OFFLINE | REALM_FLAG_SPECIFYBUILD;   // tell the client what build the realm is for
-        }
-
-        if (!buildInfo)
-            flag &= ~REALM_FLAG_SPECIFYBUILD;
+    sRealmListCache->SetCharacterCounts(_accountInfo.Id, characterCounts);
 
-        std::string name = realm.Name;
-        if (_expversion & PRE_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
-        {
-            std::ostringstream ss;
-            ss << name << " (" << buildInfo->MajorVersion << '.' << buildInfo->MinorVersion << '.' << buildInfo->BugfixVersion << ')';
-            name = ss.str();
-        }
+    SendRealmList(characterCounts);
+}
 
-        uint8 lock = (realm.AllowedSecurityLevel > _accountInfo.SecurityLevel) ? 1 : 0;
+void AuthSession::SendRealmList(std::map<uint32, uint8> const& characterCounts)
+{
+    // Circle through the cached realm entries and construct the return packet (including # of user characters in each realm)
+    std::shared_ptr<RealmListCacheEntries const> realmList = sRealmListCache->GetRealmList(_build, _expversion, _accountInfo.SecurityLevel);
 
-        pkt << uint8(realm.Type);                           // realm type
-        if (_expversion & POST_BC_EXP_FLAG)                 // only 2.x and 3.x clients
-            pkt << uint8(lock);                             // if 1, then realm locked
+    ByteBuffer pkt;
 
-        pkt << uint8(flag);                                 // RealmFlags
-        pkt << name;
-        pkt << boost::lexical_cast<std::string>(realm.GetAddressForClient(GetRemoteIpAddress()));
-        pkt << float(realm.PopulationLevel);
-        pkt << uint8(characterCounts[realm.Id.Realm]);
-        pkt << uint8(realm.Timezone);                       // realm category
+    std::size_t RealmListSize = 0;
+    for (RealmListCacheEntry const& entry : *realmList)
+    {
+        Realm const* realm = sRealmList->GetRealm(entry.Id);
+        if (!realm)
+            continue;
 
-        if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
-            pkt << uint8(realm.Id.Realm);
-        else
-            pkt << uint8(0x0);                              // 1.12.1 and 1.12.2 clients
+        auto characterCount = characterCounts.find(entry.Id.Realm);
 
-        if (_expversion & POST_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
-        {
-            pkt << uint8(buildInfo->MajorVersion);
-            pkt << uint8(buildInfo->MinorVersion);
-            pkt << uint8(buildInfo->BugfixVersion);
-            pkt << uint16(buildInfo->Build);
-        }
+        pkt.append(entry.BeforeAddress);
+        pkt << boost::lexical_cast<std::string>(realm->GetAddressForClient(GetRemoteIpAddress()));
+        pkt.append(entry.BeforeCharacterCount);
+        pkt << uint8(characterCount != characterCounts.end() ? characterCount->second : 0);
+        pkt.append(entry.AfterCharacterCount);
 
         ++RealmListSize;
     }
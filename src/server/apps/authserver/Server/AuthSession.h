@@ -19,6 +19,7 @@
 #define __AUTHSESSION_H__
 
 #include "AsyncCallbackProcessor.h"
+#include "AuthCryptoPool.h"
 #include "BigNumber.h"
 #include "ByteBuffer.h"
 #include "Common.h"
@@ -33,6 +34,7 @@ using boost::asio::ip::tcp;
 
 class Field;
 struct AuthHandler;
+struct AUTH_LOGON_PROOF_C;
 
 enum AuthStatus
 {
@@ -86,12 +88,15 @@ private:
 
     void CheckIpCallback(PreparedQueryResult result);
     void LogonChallengeCallback(PreparedQueryResult result);
+    void LogonChallengeSRP6Callback(uint8 securityFlags, std::shared_ptr<Acore::Crypto::SRP6> srp6);
+    void LogonProofCallback(AUTH_LOGON_PROOF_C const& logonProof, Optional<std::string> const& token, Optional<SessionKey> K);
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
+    void SendRealmList(std::map<uint32, uint8> const& characterCounts);
 
     bool VerifyVersion(uint8 const* a, int32 aLength, Acore::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
-    Optional<Acore::Crypto::SRP6> _srp6;
+    std::shared_ptr<Acore::Crypto::SRP6> _srp6;
     SessionKey _sessionKey = {};
     std::array<uint8, 16> _reconnectProof = {};
 
@@ -105,6 +110,7 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AuthCryptoCallback> _cryptoProcessor;
 };
 
 #pragma pack(push, 1)
@@ -0,0 +1,147 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "RealmListCache.h"
+#include "AuthCodes.h"
+#include "RealmList.h"
+#include <sstream>
+
+RealmListCache* RealmListCache::instance()
+{
+    static RealmListCache instance;
+    return &instance;
+}
+
+void RealmListCache::Initialize(Seconds characterCountsCacheTime)
+{
+    _characterCountsCacheTime = characterCountsCacheTime;
+}
+
+std::shared_ptr<RealmListCacheEntries const> RealmListCache::GetRealmList(uint32 build, uint8 expversion, AccountTypes securityLevel)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    uint32 updateCounter = sRealmList->GetUpdateCounter();
+    if (updateCounter != _realmListUpdateCounter)
+    {
+        _realmLists.clear();
+        _realmListUpdateCounter = updateCounter;
+    }
+
+    uint64 key = (uint64(build) << 16) | (uint64(expversion) << 8) | uint64(securityLevel);
+    std::shared_ptr<RealmListCacheEntries const>& realmList = _realmLists[key];
+    if (!realmList)
+        realmList = BuildRealmList(build, expversion, securityLevel);
+
+    return realmList;
+}
+
+std::shared_ptr<RealmListCacheEntries const> RealmListCache::BuildRealmList(uint32 build, uint8 expversion, AccountTypes securityLevel)
+{
+    std::shared_ptr<RealmListCacheEntries> realmList = std::make_shared<RealmListCacheEntries>();
+
+    for (auto const& [realmHandle, realm] : sRealmList->GetRealms())
+    {
+        // don't work with realms which not compatible with the client
+        bool okBuild = ((expversion & POST_BC_EXP_FLAG) && realm.Build == build) || ((expversion & PRE_BC_EXP_FLAG) && !AuthHelper::IsPreBCAcceptedClientBuild(realm.Build));
+
+        // No SQL injection. id of realm is controlled by the database.
+        uint32 flag = realm.Flags;
+        RealmBuildInfo const* buildInfo = sRealmList->GetBuildInfo(realm.Build);
+        if (!okBuild)
+        {
+            if (!buildInfo)
+                continue;
+
+            flag |= REALM_FLAG_OFFLINE | REALM_FLAG_SPECIFYBUILD;   // tell the client what build the realm is for
+        }
+
+        if (!buildInfo)
+            flag &= ~REALM_FLAG_SPECIFYBUILD;
+
+        std::string name = realm.Name;
+        if (expversion & PRE_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
+        {
+            std::ostringstream ss;
+            ss << name << " (" << buildInfo->MajorVersion << '.' << buildInfo->MinorVersion << '.' << buildInfo->BugfixVersion << ')';
+            name = ss.str();
+        }
+
+        uint8 lock = (realm.AllowedSecurityLevel > securityLevel) ? 1 : 0;
+
+        RealmListCacheEntry& entry = realmList->emplace_back();
+        entry.Id = realmHandle;
+
+        entry.BeforeAddress << uint8(realm.Type);           // realm type
+        if (expversion & POST_BC_EXP_FLAG)                  // only 2.x and 3.x clients
+            entry.BeforeAddress << uint8(lock);             // if 1, then realm locked
+
+        entry.BeforeAddress << uint8(flag);                 // RealmFlags
+        entry.BeforeAddress << name;
+
+        entry.BeforeCharacterCount << float(realm.PopulationLevel);
+
+        entry.AfterCharacterCount << uint8(realm.Timezone); // realm category
+
+        if (expversion & POST_BC_EXP_FLAG)                  // 2.x and 3.x clients
+            entry.AfterCharacterCount << uint8(realm.Id.Realm);
+        else
+            entry.AfterCharacterCount << uint8(0x0);        // 1.12.1 and 1.12.2 clients
+
+        if (expversion & POST_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
+        {
+            entry.AfterCharacterCount << uint8(buildInfo->MajorVersion);
+            entry.AfterCharacterCount << uint8(buildInfo->MinorVersion);
+            entry.AfterCharacterCount << uint8(buildInfo->BugfixVersion);
+            entry.AfterCharacterCount << uint16(buildInfo->Build);
+        }
+    }
+
+    return realmList;
+}
+
+Optional<std::map<uint32, uint8>> RealmListCache::GetCharacterCounts(uint32 accountId)
+{
+    if (_characterCountsCacheTime <= 0s)
+        return {};
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    auto itr = _characterCounts.find(accountId);
+    if (itr == _characterCounts.end() || itr->second.ExpireTime <= std::chrono::steady_clock::now())
+        return {};
+
+    return itr->second.Counts;
+}
+
+void RealmListCache::SetCharacterCounts(uint32 accountId, std::map<uint32, uint8> const& characterCounts)
+{
+    if (_characterCountsCacheTime <= 0s)
+        return;
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    TimePoint now = std::chrono::steady_clock::now();
+    if (now >= _nextCharacterCountsCleanup)
+    {
+        std::erase_if(_characterCounts, [now](auto const& pair) { return pair.second.ExpireTime <= now; });
+        _nextCharacterCountsCleanup = now + _characterCountsCacheTime;
+    }
+
+    _characterCounts[accountId] = { now + _characterCountsCacheTime, characterCounts };
+}
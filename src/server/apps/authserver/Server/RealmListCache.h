@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef RealmListCache_h__
+#define RealmListCache_h__
+
+#include "ByteBuffer.h"
+#include "Common.h"
+#include "Duration.h"
+#include "Optional.h"
+#include "Realm.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/// Serialized REALM_LIST entries shared by all sessions using the same client build and security level.
+/// Only the address (depends on the client ip) and the character count (depends on the account) are written per request.
+struct RealmListCacheEntry
+{
+    RealmHandle Id;
+    ByteBuffer BeforeAddress;               // type, lock, flags, name
+    ByteBuffer BeforeCharacterCount;        // population
+    ByteBuffer AfterCharacterCount;         // timezone, id, build info
+};
+
+typedef std::vector<RealmListCacheEntry> RealmListCacheEntries;
+
+class RealmListCache
+{
+public:
+    static RealmListCache* instance();
+
+    void Initialize(Seconds characterCountsCacheTime);
+
+    /// Rebuilt whenever RealmList reloaded the realms since the last call
+    std::shared_ptr<RealmListCacheEntries const> GetRealmList(uint32 build, uint8 expversion, AccountTypes securityLevel);
+
+    /// The realmcharacters table is maintained by the worldservers, counts are only kept for a short time
+    Optional<std::map<uint32, uint8>> GetCharacterCounts(uint32 accountId);
+    void SetCharacterCounts(uint32 accountId, std::map<uint32, uint8> const& characterCounts);
+
+private:
+    RealmListCache() = default;
+    ~RealmListCache() = default;
+
+    static std::shared_ptr<RealmListCacheEntries const> BuildRealmList(uint32 build, uint8 expversion, AccountTypes securityLevel);
+
+    struct CharacterCounts
+    {
+        TimePoint ExpireTime;
+        std::map<uint32, uint8> Counts;
+    };
+
+    std::mutex _lock;
+    uint32 _realmListUpdateCounter{0};
+    std::unordered_map<uint64, std::shared_ptr<RealmListCacheEntries const>> _realmLists;
+    std::unordered_map<uint32, CharacterCounts> _characterCounts;
+    Seconds _characterCountsCacheTime{0};
+    TimePoint _nextCharacterCountsCleanup;
+};
+
+#define sRealmListCache RealmListCache::instance()
+
+#endif // RealmListCache_h__
@@ -25,14 +25,17 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "BufferAllocator.h"
 #include "CliRunnable.h"
 #include "Common.h"
+#include "ConditionMgr.h"
 #include "Config.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
 #include "IoContext.h"
 #include "MapMgr.h"
+#include "MemoryTracker.h"
 #include "Metric.h"
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
@@ -290,6 +293,34 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        METRIC_VALUE("db_queue_background_login", uint64(LoginDatabase.QueueSize(SQL_OPERATION_PRIORITY_BACKGROUND)));
+        METRIC_VALUE("db_queue_background_character", uint64(CharacterDatabase.QueueSize(SQL_OPERATION_PRIORITY_BACKGROUND)));
+        METRIC_VALUE("db_queue_background_world", uint64(WorldDatabase.QueueSize(SQL_OPERATION_PRIORITY_BACKGROUND)));
+        METRIC_VALUE("db_queue_wait_login", uint64(LoginDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_NORMAL).count()), METRIC_TAG("priority", "normal"));
+        METRIC_VALUE("db_queue_wait_login", uint64(LoginDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_BACKGROUND).count()), METRIC_TAG("priority", "background"));
+        METRIC_VALUE("db_queue_wait_character", uint64(CharacterDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_NORMAL).count()), METRIC_TAG("priority", "normal"));
+        METRIC_VALUE("db_queue_wait_character", uint64(CharacterDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_BACKGROUND).count()), METRIC_TAG("priority", "background"));
+        METRIC_VALUE("db_queue_wait_world", uint64(WorldDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_NORMAL).count()), METRIC_TAG("priority", "normal"));
+        METRIC_VALUE("db_queue_wait_world", uint64(WorldDatabase.GetQueueWaitTime(SQL_OPERATION_PRIORITY_BACKGROUND).count()), METRIC_TAG("priority", "background"));
+
+        Acore::BufferPool::Statistics bufferPoolStatistics = Acore::BufferPool::GetStatistics();
+        METRIC_VALUE("buffer_pool_allocations", bufferPoolStatistics.PoolAllocations, METRIC_TAG("source", "pool"));
+        METRIC_VALUE("buffer_pool_allocations", bufferPoolStatistics.HeapAllocations, METRIC_TAG("source", "heap"));
+        METRIC_VALUE("buffer_pool_deallocations", bufferPoolStatistics.Deallocations);
+
+        for (uint32 sourceType = CONDITION_SOURCE_TYPE_NONE + 1; sourceType < CONDITION_SOURCE_TYPE_MAX; ++sourceType)
+            if (uint64 evaluations = sConditionMgr->GetEvaluationCount(ConditionSourceType(sourceType)))
+                METRIC_VALUE("condition_evaluations", evaluations, METRIC_TAG("source_type", std::to_string(sourceType)));
+
+        if (Acore::MemoryTracker::IsEnabled())
+        {
+            for (uint8 tag = 0; tag < uint8(MemoryTag::Max); ++tag)
+            {
+                Acore::MemoryTracker::Statistics memoryStatistics = Acore::MemoryTracker::GetStatistics(MemoryTag(tag));
+                METRIC_VALUE("memory_bytes", memoryStatistics.Bytes, METRIC_TAG("subsystem", Acore::MemoryTracker::GetTagName(MemoryTag(tag))));
+                METRIC_VALUE("memory_allocations", memoryStatistics.Allocations, METRIC_TAG("subsystem", Acore::MemoryTracker::GetTagName(MemoryTag(tag))));
+            }
+        }
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
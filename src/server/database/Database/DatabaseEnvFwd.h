@@ -20,6 +20,14 @@
 
 #include <future>
 
+//- Scheduling class of an asynchronous operation, see SQLOperationQueue
+enum SQLOperationPriority
+{
+    SQL_OPERATION_PRIORITY_NORMAL,          // Default, executed in order of submission
+    SQL_OPERATION_PRIORITY_BACKGROUND,      // Maintenance work, yields to normal operations
+    MAX_SQL_OPERATION_PRIORITY
+};
+
 struct QueryResultFieldMetadata;
 class Field;
 
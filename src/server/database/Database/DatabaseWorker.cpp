@@ -16,10 +16,11 @@
  */
 
 #include "DatabaseWorker.h"
-#include "PCQueue.h"
+#include "MemoryTracker.h"
 #include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(SQLOperationQueue* newQueue, MySQLConnection* connection)
 {
     _connection = connection;
     _queue = newQueue;
@@ -36,6 +37,8 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    Acore::MemoryTagScope memoryTag(MemoryTag::Database);
+
     for (;;)
     {
         SQLOperation* operation = nullptr;
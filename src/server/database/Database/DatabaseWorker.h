@@ -22,20 +22,17 @@
 #include <atomic>
 #include <thread>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class MySQLConnection;
-class SQLOperation;
+class SQLOperationQueue;
 
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(SQLOperationQueue* newQueue, MySQLConnection* connection);
     ~DatabaseWorker();
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* _queue;
+    SQLOperationQueue* _queue;
     MySQLConnection* _connection;
 
     void WorkerThread();
@@ -21,14 +21,15 @@
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
+#include "MemoryTracker.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
-#include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
 #include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
 #include <limits>
@@ -53,7 +54,7 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
-    _queue(new ProducerConsumerQueue<SQLOperation*>()),
+    _queue(new SQLOperationQueue()),
     _async_threads(0),
     _synch_threads(0)
 {
@@ -180,6 +181,8 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
 template <class T>
 QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Database);
+
     auto connection = GetFreeConnection();
 
     ResultSet* result = connection->Query(sql);
@@ -197,6 +200,8 @@ QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 template <class T>
 PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Database);
+
     auto connection = GetFreeConnection();
     PreparedResultSet* ret = connection->Query(stmt);
     connection->Unlock();
@@ -250,7 +255,7 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority /*= SQL_OPERATION_PRIORITY_NORMAL*/)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -269,7 +274,7 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    Enqueue(new TransactionTask(transaction), priority);
 }
 
 template <class T>
@@ -367,7 +372,7 @@ void DatabaseWorkerPool<T>::KeepAlive()
     auto const count = _connections[IDX_ASYNC].size();
 
     for (uint8 i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+        Enqueue(new PingOperation, SQL_OPERATION_PRIORITY_BACKGROUND);
 }
 
 /**
@@ -466,9 +471,9 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, SQLOperationPriority priority /*= SQL_OPERATION_PRIORITY_NORMAL*/)
 {
-    _queue->Push(op);
+    _queue->Push(op, priority);
 }
 
 template <class T>
@@ -477,6 +482,18 @@ std::size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queue->Size();
 }
 
+template <class T>
+std::size_t DatabaseWorkerPool<T>::QueueSize(SQLOperationPriority priority) const
+{
+    return _queue->Size(priority);
+}
+
+template <class T>
+Milliseconds DatabaseWorkerPool<T>::GetQueueWaitTime(SQLOperationPriority priority) const
+{
+    return _queue->GetLastWaitTime(priority);
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -522,10 +539,10 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, SQLOperationPriority priority /*= SQL_OPERATION_PRIORITY_NORMAL*/)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
-    Enqueue(task);
+    Enqueue(task, priority);
 }
 
 template <class T>
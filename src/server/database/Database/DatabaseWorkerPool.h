@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
 #include <vector>
@@ -38,10 +39,8 @@
 */
 #define MIN_MYSQL_SERVER_VERSION "8.0.0"
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class SQLOperation;
+class SQLOperationQueue;
 struct MySQLConnectionInfo;
 
 template <class T>
@@ -94,7 +93,8 @@ public:
 
     //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    void Execute(PreparedStatement<T>* stmt);
+    //! Maintenance statements should pass SQL_OPERATION_PRIORITY_BACKGROUND so they don't delay gameplay queries.
+    void Execute(PreparedStatement<T>* stmt, SQLOperationPriority priority = SQL_OPERATION_PRIORITY_NORMAL);
 
     /**
         Direct synchronous one-way statement methods.
@@ -171,7 +171,7 @@ public:
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    void CommitTransaction(SQLTransaction<T> transaction);
+    void CommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority = SQL_OPERATION_PRIORITY_NORMAL);
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
@@ -214,13 +214,17 @@ public:
     }
 
     [[nodiscard]] std::size_t QueueSize() const;
+    [[nodiscard]] std::size_t QueueSize(SQLOperationPriority priority) const;
+
+    //! Time the most recently started async operation of the given priority spent waiting in the queue.
+    [[nodiscard]] Milliseconds GetQueueWaitTime(SQLOperationPriority priority) const;
 
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
-    void Enqueue(SQLOperation* op);
+    void Enqueue(SQLOperation* op, SQLOperationPriority priority = SQL_OPERATION_PRIORITY_NORMAL);
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -229,7 +233,7 @@ private:
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
     //! Queue shared by async worker threads.
-    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    std::unique_ptr<SQLOperationQueue> _queue;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
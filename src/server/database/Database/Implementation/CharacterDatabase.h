@@ -131,7 +131,6 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHARACTER_GIFT_BY_ITEM,
     CHAR_SEL_ACCOUNT_BY_NAME,
     CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES,
-    CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES,
     CHAR_SEL_MATCH_MAKER_RATING,
     CHAR_SEL_CHARACTER_COUNT,
     CHAR_UPD_NAME_BY_GUID,
@@ -538,7 +537,7 @@ public:
 
     //- Constructors for sync and async connections
     CharacterDatabaseConnection(MySQLConnectionInfo& connInfo);
-    CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    CharacterDatabaseConnection(SQLOperationQueue* q, MySQLConnectionInfo& connInfo);
     ~CharacterDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
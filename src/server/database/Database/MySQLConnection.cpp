@@ -55,7 +55,7 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_connectionInfo(connInfo),
     m_connectionFlags(CONNECTION_SYNCH) { }
 
-MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
+MySQLConnection::MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
     m_Mysql(nullptr),
@@ -544,12 +544,29 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     if (!_Query(stmt, &mysqlStmt, &result, &rowCount, &fieldCount))
         return nullptr;
 
+    // rows are fetched unbuffered, they must be read before moving on to the next result
+    // rowCount is the affected rows count, meaningless for a SELECT, the result set counts the rows it fetched
+    PreparedResultSet* preparedResult = new PreparedResultSet(mysqlStmt->GetSTMT(), result, fieldCount);
+
     if (mysql_more_results(m_Mysql))
     {
         mysql_next_result(m_Mysql);
     }
 
-    return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
+    if (uint32 lErrno = preparedResult->GetFetchError())
+    {
+        delete preparedResult;
+
+        MYSQL_STMT* msql_STMT = mysqlStmt->GetSTMT();
+        LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", mysqlStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return Query(stmt);                                       // Try again
+
+        return nullptr;
+    }
+
+    return preparedResult;
 }
 
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 attempts /*= 5*/)
@@ -21,9 +21,14 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include <algorithm>
+#include <errmsg.h>
 
 namespace
 {
+    /// Initial row buffer size for string and blob columns, the max length of a column is not known before its rows are fetched
+    constexpr uint32 MaxInitialStringSize = 1024;
+
     static uint32 SizeForType(MYSQL_FIELD* field)
     {
         switch (field->type)
@@ -56,7 +61,8 @@ namespace
             case MYSQL_TYPE_BLOB:
             case MYSQL_TYPE_STRING:
             case MYSQL_TYPE_VAR_STRING:
-                return field->max_length + 1;
+                // longer values are truncated by mysql_stmt_fetch and fetched again with mysql_stmt_fetch_column
+                return std::min<uint32>(field->length, MaxInitialStringSize) + 1;
 
             case MYSQL_TYPE_DECIMAL:
             case MYSQL_TYPE_NEWDECIMAL:
@@ -245,13 +251,16 @@ void ResultSet::AssertRows(std::size_t sizeRows)
     ASSERT(sizeRows == _fieldCount);
 }
 
-PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
-    m_rowCount(rowCount),
+PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint32 fieldCount) :
+    m_rowCount(0),
     m_rowPosition(0),
     m_fieldCount(fieldCount),
     m_rBind(nullptr),
     m_stmt(stmt),
-    m_metadataResult(result)
+    m_metadataResult(result),
+    m_fetchError(0),
+    m_dataChunkPos(nullptr),
+    m_dataChunkFree(0)
 {
     if (!m_metadataResult)
         return;
@@ -274,19 +283,9 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     memset(m_rBind, 0, sizeof(MySQLBind) * m_fieldCount);
     memset(m_length, 0, sizeof(unsigned long) * m_fieldCount);
 
-    //- This is where we store the (entire) resultset
-    if (mysql_stmt_store_result(m_stmt))
-    {
-        LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
-        delete[] m_rBind;
-        delete[] m_isNull;
-        delete[] m_length;
-        return;
-    }
-
-    m_rowCount = mysql_stmt_num_rows(m_stmt);
-
     //- This is where we prepare the buffer based on metadata
+    //- The result set is not stored client side (no mysql_stmt_store_result), rows are fetched one by one
+    //  straight from the connection into a single row sized buffer and then packed into m_dataChunks
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
     m_fieldMetadata.resize(m_fieldCount);
     std::size_t rowSize = 0;
@@ -306,10 +305,10 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
+    std::vector<char> rowBuffer(rowSize);
     for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
     {
-        m_rBind[i].buffer = dataBuffer + offset;
+        m_rBind[i].buffer = rowBuffer.data() + offset;
         offset += m_rBind[i].buffer_length;
     }
 
@@ -324,51 +323,56 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         return;
     }
 
-    m_rows.resize(uint32(m_rowCount) * m_fieldCount);
-
-    while (_NextRow())
+    while (!m_fetchError && _NextRow())
     {
         for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+            Field& value = m_rows.emplace_back();
+            value.SetMetadata(&m_fieldMetadata[fIndex]);
 
             unsigned long buffer_length = m_rBind[fIndex].buffer_length;
             unsigned long fetched_length = *m_rBind[fIndex].length;
-            if (!*m_rBind[fIndex].is_null)
+            if (*m_rBind[fIndex].is_null)
+            {
+                value.SetByteValue(nullptr, fetched_length);
+                continue;
+            }
+
+            // one extra byte so string and blob values are always null-terminated
+            char* data = AllocateFieldData(fetched_length + 1);
+            data[fetched_length] = '\0';
+
+            if (fetched_length > buffer_length)
             {
-                void* buffer = m_stmt->bind[fIndex].buffer;
-                switch (m_rBind[fIndex].buffer_type)
+                // value did not fit in the row buffer (MYSQL_DATA_TRUNCATED), fetch it again directly into its final storage
+                MySQLBind column = m_rBind[fIndex];
+                column.buffer = data;
+                column.buffer_length = fetched_length;
+                if (mysql_stmt_fetch_column(m_stmt, &column, fIndex, 0))
                 {
-                case MYSQL_TYPE_TINY_BLOB:
-                case MYSQL_TYPE_MEDIUM_BLOB:
-                case MYSQL_TYPE_LONG_BLOB:
-                case MYSQL_TYPE_BLOB:
-                case MYSQL_TYPE_STRING:
-                case MYSQL_TYPE_VAR_STRING:
-                    // warning - the string will not be null-terminated if there is no space for it in the buffer
-                    // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
-                    // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
-                    // in this case using Field::GetCString will result in garbage
-                    /// @todo: remove Field::GetCString and use std::string_view in C++17
-                    if (fetched_length < buffer_length)
-                        *((char*)buffer + fetched_length) = '\0';
-                    break;
-                default:
+                    m_fetchError = mysql_stmt_errno(m_stmt) ? mysql_stmt_errno(m_stmt) : CR_UNKNOWN_ERROR;
+                    LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch_column, cannot fetch truncated column {}. Error: [{}] {}", __FUNCTION__, fIndex, m_fetchError, mysql_stmt_error(m_stmt));
                     break;
                 }
-
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue((char const*)buffer, fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
             }
             else
-            {
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue(nullptr, *m_rBind[fIndex].length);
-            }
+                memcpy(data, m_rBind[fIndex].buffer, fetched_length);
+
+            value.SetByteValue(data, fetched_length);
         }
 
-        m_rowPosition++;
+        if (!m_fetchError)
+            ++m_rowCount;
+    }
+
+    // never hand out a partial result, the caller handles the error and may retry the query
+    if (m_fetchError)
+    {
+        m_rows.clear();
+        m_dataChunks.clear();
+        m_dataChunkPos = nullptr;
+        m_dataChunkFree = 0;
+        m_rowCount = 0;
     }
 
     m_rowPosition = 0;
@@ -395,12 +399,36 @@ bool PreparedResultSet::NextRow()
 bool PreparedResultSet::_NextRow()
 {
     /// Only called in low-level code, namely the constructor
-    /// Will iterate over every row of data and buffer it
-    if (m_rowPosition >= m_rowCount)
-        return false;
-
+    /// Will fetch the next row from the server into the bound row buffer
     int retval = mysql_stmt_fetch(m_stmt);
-    return retval == 0 || retval == MYSQL_DATA_TRUNCATED;
+    if (retval == 0 || retval == MYSQL_DATA_TRUNCATED)
+        return true;
+
+    if (retval != MYSQL_NO_DATA)
+    {
+        m_fetchError = mysql_stmt_errno(m_stmt) ? mysql_stmt_errno(m_stmt) : CR_UNKNOWN_ERROR;
+        LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch, cannot fetch row from MySQL server. Error: [{}] {}", __FUNCTION__, m_fetchError, mysql_stmt_error(m_stmt));
+    }
+
+    return false;
+}
+
+char* PreparedResultSet::AllocateFieldData(std::size_t size)
+{
+    if (size > m_dataChunkFree)
+    {
+        // values larger than a chunk get a dedicated allocation, the current chunk stays open for later values
+        if (size > DataChunkSize)
+            return m_dataChunks.emplace_back(std::make_unique<char[]>(size)).get();
+
+        m_dataChunkPos = m_dataChunks.emplace_back(std::make_unique<char[]>(DataChunkSize)).get();
+        m_dataChunkFree = DataChunkSize;
+    }
+
+    char* data = m_dataChunkPos;
+    m_dataChunkPos += size;
+    m_dataChunkFree -= size;
+    return data;
 }
 
 Field* PreparedResultSet::Fetch() const
@@ -423,7 +451,6 @@ void PreparedResultSet::CleanUp()
 
     if (m_rBind)
     {
-        delete[](char*)m_rBind->buffer;
         delete[] m_rBind;
         m_rBind = nullptr;
     }
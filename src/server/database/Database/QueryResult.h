@@ -21,6 +21,7 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -45,6 +46,7 @@ private:
     pointer _ptr;
 };
 
+/// Result of an ad-hoc query, NextRow() walks the MYSQL_RES row by row and only the current row is held as Field objects
 class AC_DATABASE_API ResultSet
 {
 public:
@@ -95,16 +97,21 @@ private:
     ResultSet& operator=(ResultSet const& right) = delete;
 };
 
+/// Result of a prepared statement, rows are fetched unbuffered from the connection and packed into m_rows.
+/// The whole result is read in the constructor, the connection is released to other queries as soon as it returns.
 class AC_DATABASE_API PreparedResultSet
 {
 public:
-    PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+    PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint32 fieldCount);
     ~PreparedResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return m_rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return m_fieldCount; }
 
+    /// MySQL error code of a failed row fetch, the result set holds no rows in that case
+    [[nodiscard]] uint32 GetFetchError() const { return m_fetchError; }
+
     [[nodiscard]] Field* Fetch() const;
     Field const& operator[](std::size_t index) const;
 
@@ -138,9 +145,16 @@ private:
     MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
+    uint32 m_fetchError;
+
+    static constexpr std::size_t DataChunkSize = 64 * 1024;
+    std::vector<std::unique_ptr<char[]>> m_dataChunks;    ///< Field values, packed back to back in fixed size chunks
+    char* m_dataChunkPos;
+    std::size_t m_dataChunkFree;
 
     void CleanUp();
     bool _NextRow();
+    char* AllocateFieldData(std::size_t size);
 
     void AssertRows(std::size_t sizeRows);
 
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SQLOperationQueue.h"
+#include "SQLOperation.h"
+
+namespace
+{
+    /// Background operations older than this are run even if normal operations are waiting
+    constexpr Milliseconds BackgroundMaxWaitTime = 10s;
+}
+
+void SQLOperationQueue::Push(SQLOperation* operation, SQLOperationPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(_queueLock);
+        _queues[priority].push({ operation, std::chrono::steady_clock::now() });
+    }
+
+    _condition.notify_one();
+}
+
+void SQLOperationQueue::WaitAndPop(SQLOperation*& operation)
+{
+    std::unique_lock<std::mutex> lock(_queueLock);
+
+    // Wait for the queue to have an element or the cancel/shutdown flag
+    _condition.wait(lock, [this] { return !Empty() || _cancel || _shutdown; });
+
+    if (Empty() || _cancel)
+        return;
+
+    TimePoint now = std::chrono::steady_clock::now();
+
+    std::queue<QueuedOperation>* queue = &_queues[SQL_OPERATION_PRIORITY_NORMAL];
+    std::queue<QueuedOperation>& background = _queues[SQL_OPERATION_PRIORITY_BACKGROUND];
+    if (queue->empty() || (!background.empty() && now - background.front().EnqueueTime >= BackgroundMaxWaitTime))
+        queue = &background;
+
+    QueuedOperation& front = queue->front();
+    operation = front.Operation;
+    _lastWaitTime[queue == &background ? SQL_OPERATION_PRIORITY_BACKGROUND : SQL_OPERATION_PRIORITY_NORMAL]
+        .store(std::chrono::duration_cast<Milliseconds>(now - front.EnqueueTime).count(), std::memory_order_relaxed);
+    queue->pop();
+}
+
+void SQLOperationQueue::Cancel()
+{
+    std::lock_guard<std::mutex> lock(_queueLock);
+    for (std::queue<QueuedOperation>& queue : _queues)
+    {
+        while (!queue.empty())
+        {
+            delete queue.front().Operation;
+            queue.pop();
+        }
+    }
+
+    _cancel = true;
+    _condition.notify_all();
+}
+
+void SQLOperationQueue::Shutdown()
+{
+    _shutdown = true;
+    _condition.notify_all();
+}
+
+std::size_t SQLOperationQueue::Size() const
+{
+    std::lock_guard<std::mutex> lock(_queueLock);
+    std::size_t size = 0;
+    for (std::queue<QueuedOperation> const& queue : _queues)
+        size += queue.size();
+
+    return size;
+}
+
+std::size_t SQLOperationQueue::Size(SQLOperationPriority priority) const
+{
+    std::lock_guard<std::mutex> lock(_queueLock);
+    return _queues[priority].size();
+}
+
+bool SQLOperationQueue::Empty() const
+{
+    for (std::queue<QueuedOperation> const& queue : _queues)
+        if (!queue.empty())
+            return false;
+
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _SQLOPERATIONQUEUE_H
+#define _SQLOPERATIONQUEUE_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+class SQLOperation;
+
+/// Queue shared by the async connections of a DatabaseWorkerPool.
+/// Operations are kept in one FIFO per SQLOperationPriority, background operations only run
+/// when no normal operation is waiting or when they have been waiting for too long.
+class AC_DATABASE_API SQLOperationQueue
+{
+public:
+    SQLOperationQueue() = default;
+
+    void Push(SQLOperation* operation, SQLOperationPriority priority);
+
+    /// Blocks until an operation is available, leaves operation untouched on cancel/shutdown
+    void WaitAndPop(SQLOperation*& operation);
+
+    /// Clears the queue and immediately stops any consumers.
+    void Cancel();
+
+    /// Graceful stop: waits for the queue to become empty before stopping consumers.
+    void Shutdown();
+
+    [[nodiscard]] std::size_t Size() const;
+    [[nodiscard]] std::size_t Size(SQLOperationPriority priority) const;
+
+    /// Time the last dequeued operation of the given priority spent in the queue
+    [[nodiscard]] Milliseconds GetLastWaitTime(SQLOperationPriority priority) const { return Milliseconds(_lastWaitTime[priority].load(std::memory_order_relaxed)); }
+
+private:
+    struct QueuedOperation
+    {
+        SQLOperation* Operation;
+        TimePoint EnqueueTime;
+    };
+
+    mutable std::mutex _queueLock;
+    std::array<std::queue<QueuedOperation>, MAX_SQL_OPERATION_PRIORITY> _queues;
+    std::array<std::atomic<int64>, MAX_SQL_OPERATION_PRIORITY> _lastWaitTime{};
+    std::condition_variable _condition;
+    std::atomic<bool> _cancel{};
+    std::atomic<bool> _shutdown{};
+
+    [[nodiscard]] bool Empty() const;
+
+    SQLOperationQueue(SQLOperationQueue const& right) = delete;
+    SQLOperationQueue& operator=(SQLOperationQueue const& right) = delete;
+};
+
+#endif
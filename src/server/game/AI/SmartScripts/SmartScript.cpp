@@ -134,27 +134,27 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    if (e == SMART_EVENT_LINK)//special handling
+        return;
+
+    auto itr = mEventsByType.find(e);
+    if (itr == mEventsByType.end())
+        return;
+
+    for (SmartScriptHolder* holder : itr->second)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        ConditionList conds = sConditionMgr->GetConditionsForSmartEvent(holder->entryOrGuid, holder->event_id, holder->source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
-        if (eventType == e)
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
         {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
-
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+            ASSERT(executionStack.empty());
+            executionStack.emplace_back(SmartScriptFrame{ *holder, unit, var0, var1, bvar, spell, gob });
+            while (!executionStack.empty())
             {
-                ASSERT(executionStack.empty());
-                executionStack.emplace_back(SmartScriptFrame{ *i, unit, var0, var1, bvar, spell, gob });
-                while (!executionStack.empty())
-                {
-                    auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
-                    executionStack.pop_back();
-                    ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
-                }
+                auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+                executionStack.pop_back();
+                ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
             }
         }
     }
@@ -4974,6 +4974,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -4987,6 +4988,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
@@ -5050,6 +5052,14 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+void SmartScript::BuildEventIndex()
+{
+    mEventsByType.clear();
+    for (SmartScriptHolder& holder : mEvents)
+        if (holder.GetEventType() != SMART_EVENT_LINK)
+            mEventsByType[holder.GetEventType()].push_back(&holder);
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1200;
@@ -5105,6 +5115,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
         }
         mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+
+    BuildEventIndex();
 }
 
 void SmartScript::GetScript()
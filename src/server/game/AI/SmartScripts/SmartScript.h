@@ -214,10 +214,13 @@ private:
     bool IsInPhase(uint32 p) const;
 
     void SortEvents(SmartAIEventList& events);
+    void BuildEventIndex();
     void RaisePriority(SmartScriptHolder& e);
     void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
     SmartAIEventList mEvents;
+    // mEvents grouped by event type, in mEvents order; rebuilt whenever mEvents is filled, extended or sorted
+    std::unordered_map<uint32, std::vector<SmartScriptHolder*>> mEventsByType;
     SmartAIEventList mInstallEvents;
     SmartAIEventList mTimedActionList;
     bool isProcessingTimedActionList;
@@ -483,6 +483,7 @@ AchievementMgr::AchievementMgr(Player* player)
 {
     _player = player;
     _offlineUpdatesDelayTimer = 0;
+    _completedCriteria.resize(sAchievementCriteriaStore.GetNumRows());
 }
 
 AchievementMgr::~AchievementMgr()
@@ -507,6 +508,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _completedCriteria.assign(_completedCriteria.size(), false);
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -891,6 +893,9 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (_completedCriteria[achievementCriteria->ID])
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -2106,6 +2111,9 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
 
     LOG_DEBUG("achievement", "AchievementMgr::SetCriteriaProgress({}, {}) for {}", entry->ID, changeValue, _player->GetGUID().ToString());
 
+    // progress may be lowered here, completion has to be checked again
+    _completedCriteria[entry->ID] = false;
+
     CriteriaProgress* progress = GetCriteriaProgress(entry);
     if (!progress)
     {
@@ -2179,6 +2187,7 @@ void AchievementMgr::RemoveCriteriaProgress(const AchievementCriteriaEntry* entr
     _player->SendDirectMessage(&data);
 
     _criteriaProgress.erase(criteriaProgress);
+    _completedCriteria[entry->ID] = false;
 }
 
 void AchievementMgr::Update(uint32 timeDiff)
@@ -2466,7 +2475,13 @@ bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
 
     // don't update already completed criteria
     if (IsCompletedCriteria(criteria, achievement))
+    {
+        // realm firsts stop counting as completed once someone on the realm gets them
+        if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+            _completedCriteria[criteria->ID] = true;
+
         return false;
+    }
 
     return true;
 }
@@ -25,8 +25,10 @@
 #include "ObjectGuid.h"
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
-typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
+typedef std::vector<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
@@ -336,6 +338,8 @@ private:
     Player* _player;
     CriteriaProgressMap _criteriaProgress;
     CompletedAchievementMap _completedAchievements;
+    // criteria ids known to be completed, skipped by UpdateAchievementCriteria without any lookups
+    std::vector<bool> _completedCriteria;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
 
@@ -363,11 +367,10 @@ public:
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        auto itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
     AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
@@ -443,8 +446,8 @@ private:
     AchievementRewards _achievementRewards;
     AchievementRewardLocales _achievementRewardLocales;
 
-    // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    // pussywizard: criterias by type and their primary misc value (creature entry, item, spell, ...)
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
     std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
 };
 
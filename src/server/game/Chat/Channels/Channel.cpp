@@ -150,7 +150,7 @@ void Channel::CleanOldChannelsInDB()
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_OLD_CHANNELS_BANS);
         trans->Append(stmt);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, SQL_OPERATION_PRIORITY_BACKGROUND);
     }
 }
 
@@ -906,16 +906,18 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            i->second.plrPtr->GetSession()->SendPacket(sharedData);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            i->second.plrPtr->GetSession()->SendPacket(sharedData);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -926,8 +928,12 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 
 void Channel::SendToAllWatching(WorldPacket* data)
 {
+    if (playersWatchingStore.empty())
+        return;
+
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
     for (PlayersWatchingContainer::const_iterator i = playersWatchingStore.begin(); i != playersWatchingStore.end(); ++i)
-        (*i)->GetSession()->SendPacket(data);
+        (*i)->GetSession()->SendPacket(sharedData);
 }
 
 bool Channel::ShouldAnnouncePlayer(Player const* player) const
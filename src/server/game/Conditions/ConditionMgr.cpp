@@ -29,6 +29,7 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 #include "WorldState.h"
+#include <boost/container/small_vector.hpp>
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -591,6 +592,49 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     return condMeets; // && script;
 }
 
+uint8 Condition::GetEvaluationCost() const
+{
+    // references evaluate a whole list of their own
+    if (ReferenceId)
+        return 3;
+
+    switch (ConditionType)
+    {
+        // plain field reads on the target
+        case CONDITION_CLASS:
+        case CONDITION_RACE:
+        case CONDITION_GENDER:
+        case CONDITION_LEVEL:
+        case CONDITION_TEAM:
+        case CONDITION_MAPID:
+        case CONDITION_ZONEID:
+        case CONDITION_AREAID:
+        case CONDITION_SPAWNMASK:
+        case CONDITION_DIFFICULTY_ID:
+        case CONDITION_PHASEMASK:
+        case CONDITION_TYPE_MASK:
+        case CONDITION_OBJECT_ENTRY_GUID:
+        case CONDITION_CREATURE_TYPE:
+        case CONDITION_ALIVE:
+        case CONDITION_HP_VAL:
+        case CONDITION_HP_PCT:
+        case CONDITION_UNIT_STATE:
+        case CONDITION_STAND_STATE:
+        case CONDITION_CHARMED:
+        case CONDITION_TAXI:
+        case CONDITION_DRUNKENSTATE:
+        case CONDITION_TITLE:
+            return 0;
+        // grid searches and terrain queries
+        case CONDITION_NEAR_CREATURE:
+        case CONDITION_NEAR_GAMEOBJECT:
+        case CONDITION_IN_WATER:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
 uint32 Condition::GetSearcherTypeMaskForCondition()
 {
     // build mask of types for which condition can return true
@@ -874,46 +918,45 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
+    //                                                   groupId, groupCheckPassed
+    boost::container::small_vector<std::pair<uint32, bool>, 4> ElseGroupStore;
+    for (Condition* condition : conditions)
     {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
-        if ((*i)->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
-                continue;
+        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", condition->ConditionType, condition->ConditionValue1);
+        if (!condition->isLoaded())
+            continue;
+
+        //! Lists are ordered by ElseGroup, so the group is usually the last one in the store
+        auto itr = ElseGroupStore.end();
+        if (!ElseGroupStore.empty() && ElseGroupStore.back().first == condition->ElseGroup)
+            itr = std::prev(ElseGroupStore.end());
+        else
+            itr = std::find_if(ElseGroupStore.begin(), ElseGroupStore.end(), [condition](std::pair<uint32, bool> const& group) { return group.first == condition->ElseGroup; });
 
-            if ((*i)->ReferenceId) // handle reference
+        //! If not found, add an entry in the store and set to true (placeholder)
+        if (itr == ElseGroupStore.end())
+            itr = ElseGroupStore.emplace(ElseGroupStore.end(), condition->ElseGroup, true);
+        else if (!itr->second)
+            continue; // cheaper conditions of the group already failed
+
+        if (condition->ReferenceId) // handle reference
+        {
+            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
+            if (ref != ConditionReferenceStore.end())
             {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
-                }
-                else
-                {
-                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", (*i)->ReferenceId);
-                }
+                if (!IsObjectMeetToConditionList(sourceInfo, ref->second))
+                    itr->second = false;
             }
-            else // handle normal condition
+            else
             {
-                if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
+                LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", condition->ReferenceId);
             }
         }
+        else if (!condition->Meets(sourceInfo)) // handle normal condition
+            itr->second = false;
     }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
-            return true;
 
-    return false;
+    return std::any_of(ElseGroupStore.begin(), ElseGroupStore.end(), [](std::pair<uint32, bool> const& group) { return group.second; });
 }
 
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions)
@@ -933,6 +976,10 @@ bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, Con
     if (conditions.empty())
         return true;
 
+    ConditionSourceType sourceType = conditions.front()->SourceType;
+    if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
+        _evaluationCounts[sourceType].fetch_add(1, std::memory_order_relaxed);
+
     LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditions");
     return IsObjectMeetToConditionList(sourceInfo, conditions);
 }
@@ -949,6 +996,27 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT);
 }
 
+void ConditionMgr::InsertCondition(ConditionList& conditions, Condition* cond)
+{
+    auto itr = std::upper_bound(conditions.begin(), conditions.end(), cond, [](Condition const* left, Condition const* right)
+    {
+        if (left->ElseGroup != right->ElseGroup)
+            return left->ElseGroup < right->ElseGroup;
+
+        return left->GetEvaluationCost() < right->GetEvaluationCost();
+    });
+
+    conditions.insert(itr, cond);
+}
+
+uint64 ConditionMgr::GetEvaluationCount(ConditionSourceType sourceType) const
+{
+    if (sourceType <= CONDITION_SOURCE_TYPE_NONE || sourceType >= CONDITION_SOURCE_TYPE_MAX)
+        return 0;
+
+    return _evaluationCounts[sourceType].load(std::memory_order_relaxed);
+}
+
 ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
 {
     ConditionList spellCond;
@@ -1151,7 +1219,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 ConditionList mCondList;
                 ConditionReferenceStore[uRefId] = mCondList;
             }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            InsertCondition(ConditionReferenceStore[uRefId], cond); // add to reference storage
             count++;
             continue;
         } // end of reference templates
@@ -1239,7 +1307,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                InsertCondition(SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1249,7 +1317,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                InsertCondition(VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1258,14 +1326,14 @@ void ConditionMgr::LoadConditions(bool isReload)
             {
                 //! TODO: PAIR_32 ?
                 std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                InsertCondition(SmartEventConditionStore[key][cond->SourceGroup], cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                InsertCondition(NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue;
@@ -1308,7 +1376,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        InsertCondition(ConditionStore[cond->SourceType][cond->SourceEntry], cond);
         ++count;
     } while (result->NextRow());
 
@@ -1341,7 +1409,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.TextID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                InsertCondition((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1360,7 +1428,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.OptionID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                InsertCondition((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1449,7 +1517,7 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond)
                     delete sharedList;
             }
             if (sharedList)
-                sharedList->push_back(cond);
+                InsertCondition(*sharedList, cond);
             break;
         }
     }
@@ -19,8 +19,11 @@
 #define ACORE_CONDITIONMGR_H
 
 #include "Define.h"
+#include <array>
+#include <atomic>
 #include <list>
 #include <map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -230,11 +233,13 @@ struct Condition
 
     bool Meets(ConditionSourceInfo& sourceInfo);
     uint32 GetSearcherTypeMaskForCondition();
+    [[nodiscard]] uint8 GetEvaluationCost() const;
     [[nodiscard]] bool isLoaded() const { return ConditionType > CONDITION_NONE || ReferenceId; }
     uint32 GetMaxAvailableConditionTargets();
 };
 
-typedef std::list<Condition*> ConditionList;
+// kept ordered by ElseGroup and evaluation cost, see ConditionMgr::InsertCondition
+typedef std::vector<Condition*> ConditionList;
 typedef std::map<uint32, ConditionList> ConditionTypeContainer;
 typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
@@ -268,6 +273,11 @@ public:
     ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
     ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
 
+    // adds the condition after all conditions of lower ElseGroup or cheaper to evaluate
+    static void InsertCondition(ConditionList& conditions, Condition* cond);
+
+    [[nodiscard]] uint64 GetEvaluationCount(ConditionSourceType sourceType) const;
+
 private:
     bool isSourceTypeValid(Condition* cond);
     bool addToLootTemplate(Condition* cond, LootTemplate* loot);
@@ -285,6 +295,8 @@ private:
     CreatureSpellConditionContainer   SpellClickEventConditionStore;
     NpcVendorConditionContainer       NpcVendorConditionContainerStore;
     SmartEventConditionContainer      SmartEventConditionStore;
+
+    std::array<std::atomic<uint64>, CONDITION_SOURCE_TYPE_MAX> _evaluationCounts;
 };
 
 #define sConditionMgr ConditionMgr::instance()
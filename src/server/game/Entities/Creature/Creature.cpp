@@ -32,6 +32,7 @@
 #include "Log.h"
 #include "LootMgr.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
@@ -271,7 +272,7 @@ bool TemporaryThreatModifierEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 
 Creature::Creature(bool isWorldObject): Unit(isWorldObject), MovableMapObject(), m_groupLootTimer(0), lootingGroupLowGUID(0), m_lootRecipientGroup(0),
     m_corpseRemoveTime(0), m_respawnTime(0), m_respawnDelay(300), m_corpseDelay(60), m_wanderDistance(0.0f), m_boundaryCheckTime(2500),
-    m_transportCheckTimer(1000), lootPickPocketRestoreTime(0), m_combatPulseTime(0), m_combatPulseDelay(0), m_reactState(REACT_AGGRESSIVE), m_defaultMovementType(IDLE_MOTION_TYPE),
+    m_transportCheckTimer(1000), lootPickPocketRestoreTime(0), m_combatPulseTime(0), m_combatPulseDelay(0), m_idleUpdateDiff(0), m_reactState(REACT_AGGRESSIVE), m_defaultMovementType(IDLE_MOTION_TYPE),
     m_spawnId(0), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false),
     m_AlreadySearchedAssistance(false), m_regenHealth(true), m_regenPower(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false),
     m_homePosition(), m_transportHomePosition(), m_creatureInfo(nullptr), m_creatureData(nullptr), m_detectionDistance(20.0f),_sparringPct(0.0f), m_waypointID(0), m_path_id(0), m_formation(nullptr), m_lastLeashExtensionTime(nullptr), m_cannotReachTimer(0),
@@ -310,6 +311,21 @@ Creature::~Creature()
     i_AI = nullptr;
 }
 
+namespace
+{
+    Acore::ObjectPool CreaturePool("Creature");
+}
+
+void* Creature::operator new(std::size_t size)
+{
+    return CreaturePool.Allocate(size);
+}
+
+void Creature::operator delete(void* ptr, std::size_t size)
+{
+    CreaturePool.Deallocate(ptr, size);
+}
+
 void Creature::AddToWorld()
 {
     ///- Register the creature for guid lookup
@@ -663,6 +679,9 @@ bool Creature::UpdateEntry(uint32 Entry, const CreatureData* data, bool changele
 
 void Creature::Update(uint32 diff)
 {
+    if (DeferIdleUpdate(diff))
+        return;
+
     if (IsAIEnabled && TriggerJustRespawned)
     {
         TriggerJustRespawned = false;
@@ -937,6 +956,31 @@ void Creature::Update(uint32 diff)
     }
 }
 
+// Creatures out of combat and away from players may be updated less often than every map tick.
+// Returns true if this update can be skipped, otherwise diff is extended by the skipped time.
+bool Creature::DeferIdleUpdate(uint32& diff)
+{
+    Map* map = FindMap();
+    uint32 interval = map ? map->GetIdleCreatureUpdateInterval() : 0;
+    if (interval && !IsInCombat() && !IsInEvadeMode() && !isActiveObject() && !GetCharmerOrOwnerGUID() && !HasUnitTypeMask(UNIT_MASK_MINION)
+        && !map->IsNearPlayers(GetPositionX(), GetPositionY()))
+    {
+        m_idleUpdateDiff += diff;
+        if (m_idleUpdateDiff < interval)
+        {
+            map->AddDeferredCreatureUpdate();
+            return true;
+        }
+
+        diff = m_idleUpdateDiff;
+    }
+    else
+        diff += m_idleUpdateDiff;
+
+    m_idleUpdateDiff = 0;
+    return false;
+}
+
 bool Creature::IsFreeToMove()
 {
     uint32 moveFlags = m_movementInfo.GetMovementFlags();
@@ -45,6 +45,10 @@ public:
     explicit Creature(bool isWorldObject = false);
     ~Creature() override;
 
+    // spawns, summons and pets come and go with every respawn and instance reset, see Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     void AddToWorld() override;
     void RemoveFromWorld() override;
 
@@ -458,8 +462,10 @@ protected:
     uint32 lootPickPocketRestoreTime;
     uint32 m_combatPulseTime;                           // (msecs) remaining time for next zone-in-combat pulse
     uint32 m_combatPulseDelay;
+    uint32 m_idleUpdateDiff;                            // (msecs) time accumulated while updates were deferred, see DeferIdleUpdate
 
     ReactStates m_reactState;                           // for AI, not charmInfo
+    bool DeferIdleUpdate(uint32& diff);
     void RegenerateHealth();
     void Regenerate(Powers power);
     MovementGeneratorType m_defaultMovementType;
@@ -18,6 +18,7 @@
 #include "GameTime.h"
 #include "GridNotifiers.h"
 #include "ObjectAccessor.h"
+#include "ObjectPool.h"
 #include "ScriptMgr.h"
 #include "SpellAuraEffects.h"
 #include "Transport.h"
@@ -42,6 +43,21 @@ DynamicObject::~DynamicObject()
     delete _removedAura;
 }
 
+namespace
+{
+    Acore::ObjectPool DynamicObjectPool("DynamicObject");
+}
+
+void* DynamicObject::operator new(std::size_t size)
+{
+    return DynamicObjectPool.Allocate(size);
+}
+
+void DynamicObject::operator delete(void* ptr, std::size_t size)
+{
+    DynamicObjectPool.Deallocate(ptr, size);
+}
+
 void DynamicObject::CleanupsBeforeDelete(bool finalCleanup /* = true */)
 {
     if (Transport* transport = GetTransport())
@@ -37,6 +37,10 @@ public:
     DynamicObject(bool isWorldObject);
     ~DynamicObject() override;
 
+    // created for every area spell and farsight, see Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     void AddToWorld() override;
     void RemoveFromWorld() override;
 
@@ -27,6 +27,7 @@
 #include "Group.h"
 #include "GroupMgr.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "OutdoorPvPMgr.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
@@ -82,6 +83,21 @@ GameObject::~GameObject()
     //    CleanupsBeforeDelete();
 }
 
+namespace
+{
+    Acore::ObjectPool GameObjectPool("GameObject");
+}
+
+void* GameObject::operator new(std::size_t size)
+{
+    return GameObjectPool.Allocate(size);
+}
+
+void GameObject::operator delete(void* ptr, std::size_t size)
+{
+    GameObjectPool.Deallocate(ptr, size);
+}
+
 bool GameObject::AIM_Initialize()
 {
     if (m_AI)
@@ -2599,6 +2615,9 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    if (Map* map = FindMap())
+        map->InvalidateLineOfSight();
 }
 
 void GameObject::UpdateModel()
@@ -122,6 +122,10 @@ public:
     explicit GameObject();
     ~GameObject() override;
 
+    // created with every grid load and instance, see Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) override;
 
     void AddToWorld() override;
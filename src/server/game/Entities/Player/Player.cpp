@@ -7690,7 +7690,7 @@ void Player::SendQuestGiverStatusMultiple()
     WorldPacket data(SMSG_QUESTGIVER_STATUS_MULTIPLE, 4);
     data << uint32(count); // placeholder
 
-    for (GuidUnorderedSet::const_iterator itr = m_clientGUIDs.begin(); itr != m_clientGUIDs.end(); ++itr)
+    for (GuidFlatSet::const_iterator itr = m_clientGUIDs.begin(); itr != m_clientGUIDs.end(); ++itr)
     {
         uint32 questStatus = DIALOG_STATUS_NONE;
 
@@ -14542,6 +14542,9 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
+    if (m_entryPointData == m_savedEntryPointData)
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -14557,6 +14560,8 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
     trans->Append(stmt);
+
+    m_savedEntryPointData = m_entryPointData;
 }
 
 void Player::DeleteEquipmentSet(uint64 setGuid)
@@ -15809,21 +15814,25 @@ void Player::_LoadPetStable(uint8 petStableSlots, PreparedQueryResult result)
 
 void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
 {
-    if (_instanceResetTimes.empty())
+    if (!_instanceResetTimesChanged || _instanceResetTimes.empty())
         return;
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
 
+    std::ostringstream ss;
+    ss << "INSERT INTO account_instance_times (accountId, instanceId, releaseTime) VALUES ";
     for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end(); ++itr)
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
-        stmt->SetData(0, GetSession()->GetAccountId());
-        stmt->SetData(1, itr->first);
-        stmt->SetData(2, (int64)itr->second);
-        trans->Append(stmt);
+        if (itr != _instanceResetTimes.begin())
+            ss << ',';
+
+        ss << '(' << GetSession()->GetAccountId() << ',' << itr->first << ',' << (int64)itr->second << ')';
     }
+
+    trans->Append(ss.str().c_str());
+    _instanceResetTimesChanged = false;
 }
 
 bool Player::IsInWhisperWhiteList(ObjectGuid guid)
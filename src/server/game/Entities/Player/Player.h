@@ -1064,6 +1064,12 @@ struct EntryPointData
 
     void ClearTaxiPath() { taxiPath.fill(0); }
     [[nodiscard]] bool HasTaxiPath() const { return taxiPath[0] && taxiPath[1]; }
+
+    bool operator==(EntryPointData const& right) const
+    {
+        return mountSpell == right.mountSpell && taxiPath == right.taxiPath &&
+            joinPos.GetMapId() == right.joinPos.GetMapId() && joinPos == right.joinPos;
+    }
 };
 
 struct PendingSpellCastRequest
@@ -2388,7 +2394,7 @@ public:
     void SetEntryPoint();
 
     // currently visible objects at player client
-    GuidUnorderedSet m_clientGUIDs;
+    GuidFlatSet m_clientGUIDs;
     std::vector<Unit*> m_newVisible; // pussywizard
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
@@ -2460,7 +2466,10 @@ public:
     void AddInstanceEnterTime(uint32 instanceId, time_t enterTime)
     {
         if (_instanceResetTimes.find(instanceId) == _instanceResetTimes.end())
+        {
             _instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR));
+            _instanceResetTimesChanged = true;
+        }
     }
 
     // last used pet number (for BG's)
@@ -2694,6 +2703,7 @@ protected:
     /*********************************************************/
 
     EntryPointData m_entryPointData;
+    EntryPointData m_savedEntryPointData;                   // state stored in character_entry_point, skips unchanged saves
 
     /*********************************************************/
     /***                    QUEST SYSTEM                   ***/
@@ -2997,6 +3007,7 @@ private:
     uint32 m_ChampioningFaction;
 
     InstanceTimeMap _instanceResetTimes;
+    bool _instanceResetTimesChanged{false};
     uint32 _pendingBindId;
     uint32 _pendingBindTimer;
 
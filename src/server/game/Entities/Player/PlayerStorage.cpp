@@ -4870,6 +4870,7 @@ void Player::_LoadEntryPointData(PreparedQueryResult result)
     m_entryPointData.taxiPath[0] = fields[5].Get<uint32>();
     m_entryPointData.taxiPath[1] = fields[6].Get<uint32>();
     m_entryPointData.mountSpell = fields[7].Get<uint32>();
+    m_savedEntryPointData = m_entryPointData;
 }
 
 bool Player::LoadPositionFromDB(uint32& mapid, float& x, float& y, float& z, float& o, bool& in_flight, ObjectGuid::LowType guid)
@@ -7186,6 +7187,10 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
     stmt->SetData(0, GetGUID().GetCounter());
     trans->Append(stmt);
 
+    // all saved auras go out as a single multi-row insert instead of one statement per aura
+    bool first_round = true;
+    std::ostringstream ss;
+
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
         if (!itr->second->CanBeSaved())
@@ -7216,26 +7221,23 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
             }
         }
 
-        uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
-        stmt->SetData(index++, GetGUID().GetCounter());
-        stmt->SetData(index++, itr->second->GetCasterGUID().GetRawValue());
-        stmt->SetData(index++, itr->second->GetCastItemGUID().GetRawValue());
-        stmt->SetData(index++, itr->second->GetId());
-        stmt->SetData(index++, effMask);
-        stmt->SetData(index++, recalculateMask);
-        stmt->SetData(index++, itr->second->GetStackAmount());
-        stmt->SetData(index++, damage[0]);
-        stmt->SetData(index++, damage[1]);
-        stmt->SetData(index++, damage[2]);
-        stmt->SetData(index++, baseDamage[0]);
-        stmt->SetData(index++, baseDamage[1]);
-        stmt->SetData(index++, baseDamage[2]);
-        stmt->SetData(index++, itr->second->GetMaxDuration());
-        stmt->SetData(index++, itr->second->GetDuration());
-        stmt->SetData(index, itr->second->GetCharges());
-        trans->Append(stmt);
+        if (first_round)
+        {
+            ss << "INSERT INTO character_aura (guid, casterGuid, itemGuid, spell, effectMask, recalculateMask, stackcount, amount0, amount1, amount2, base_amount0, base_amount1, base_amount2, maxDuration, remainTime, remainCharges) VALUES ";
+            first_round = false;
+        }
+        // next record prefix
+        else
+            ss << ',';
+
+        ss << '(' << GetGUID().GetCounter() << ',' << aura->GetCasterGUID().GetRawValue() << ',' << aura->GetCastItemGUID().GetRawValue() << ',' << aura->GetId()
+           << ',' << uint32(effMask) << ',' << uint32(recalculateMask) << ',' << uint32(aura->GetStackAmount())
+           << ',' << damage[0] << ',' << damage[1] << ',' << damage[2] << ',' << baseDamage[0] << ',' << baseDamage[1] << ',' << baseDamage[2]
+           << ',' << aura->GetMaxDuration() << ',' << aura->GetDuration() << ',' << uint32(aura->GetCharges()) << ')';
     }
+
+    if (!first_round)
+        trans->Append(ss.str().c_str());
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
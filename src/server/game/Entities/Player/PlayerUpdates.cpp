@@ -378,7 +378,10 @@ void Player::Update(uint32 p_time)
              itr != _instanceResetTimes.end();)
         {
             if (itr->second < now)
+            {
                 _instanceResetTimes.erase(itr++);
+                _instanceResetTimesChanged = true;
+            }
             else
                 ++itr;
         }
@@ -1635,14 +1638,14 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
 }
 
 template <class T>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, T* target,
+inline void UpdateVisibilityOf_helper(GuidFlatSet& s64, T* target,
                                       std::vector<Unit*>& /*v*/)
 {
     s64.insert(target->GetGUID());
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, GameObject* target,
+inline void UpdateVisibilityOf_helper(GuidFlatSet& s64, GameObject* target,
                                       std::vector<Unit*>& /*v*/)
 {
     // @HACK: This is to prevent objects like deeprun tram from disappearing
@@ -1652,7 +1655,7 @@ inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, GameObject* target,
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Creature* target,
+inline void UpdateVisibilityOf_helper(GuidFlatSet& s64, Creature* target,
                                       std::vector<Unit*>& v)
 {
     s64.insert(target->GetGUID());
@@ -1660,7 +1663,7 @@ inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Creature* target,
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Player* target,
+inline void UpdateVisibilityOf_helper(GuidFlatSet& s64, Player* target,
                                       std::vector<Unit*>& v)
 {
     s64.insert(target->GetGUID());
@@ -1753,7 +1756,7 @@ void Player::UpdateTriggerVisibility()
 
     UpdateData  udata;
     WorldPacket packet;
-    for (GuidUnorderedSet::iterator itr = m_clientGUIDs.begin();
+    for (GuidFlatSet::const_iterator itr = m_clientGUIDs.begin();
          itr != m_clientGUIDs.end(); ++itr)
     {
         if ((*itr).IsCreatureOrVehicle())
@@ -1796,7 +1799,7 @@ void Player::UpdateForQuestWorldObjects()
 
     UpdateData  udata;
     WorldPacket packet;
-    for (GuidUnorderedSet::iterator itr = m_clientGUIDs.begin(); itr != m_clientGUIDs.end(); ++itr)
+    for (GuidFlatSet::const_iterator itr = m_clientGUIDs.begin(); itr != m_clientGUIDs.end(); ++itr)
     {
         if ((*itr).IsGameObject())
         {
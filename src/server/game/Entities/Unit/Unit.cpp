@@ -3848,11 +3848,11 @@ uint32 Unit::GetWeaponSkillValue (WeaponAttackType attType, Unit const* target)
 
 void Unit::_DeleteRemovedAuras()
 {
-    while (!m_removedAuras.empty())
-    {
-        delete m_removedAuras.front();
-        m_removedAuras.pop_front();
-    }
+    // by index, a deleted aura may queue further removals
+    for (std::size_t i = 0; i < m_removedAuras.size(); ++i)
+        delete m_removedAuras[i];
+
+    m_removedAuras.clear();
 }
 
 void Unit::_UpdateSpells(uint32 time)
@@ -3895,6 +3895,18 @@ void Unit::_UpdateSpells(uint32 time)
 
     _DeleteRemovedAuras();
 
+    // nothing iterates the aura containers here, drop the slots of removed auras
+    m_ownedAuras.Compact();
+    m_appliedAuras.Compact();
+    if (m_modAurasToCompact.any())
+    {
+        for (uint32 auraType = 0; auraType < TOTAL_AURAS; ++auraType)
+            if (m_modAurasToCompact.test(auraType))
+                m_modAuras[auraType].Compact();
+
+        m_modAurasToCompact.reset();
+    }
+
     if (!m_gameObj.empty())
     {
         for (GameObjectList::iterator itr = m_gameObj.begin(); itr != m_gameObj.end();)
@@ -4606,7 +4618,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     // xinef: event if it gets removed, it will be reapplied in a second
     if (aura->GetSpellInfo()->AuraInterruptFlags && this == aura->GetOwner())
     {
-        m_interruptableAuras.remove(aurApp);
+        std::erase(m_interruptableAuras, aurApp);
         UpdateInterruptMask();
     }
 
@@ -4731,7 +4743,23 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
     if (apply)
         m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
     else
+    {
         m_modAuras[aurEff->GetAuraType()].remove(aurEff);
+        m_modAurasToCompact.set(aurEff->GetAuraType());
+    }
+
+    InvalidateAuraModifierCache(aurEff->GetAuraType());
+}
+
+void AuraModifierCache::Invalidate(AuraType auraType)
+{
+    TotalsValid.reset(auraType);
+    MultipliersValid.reset(auraType);
+
+    std::pair<uint32, uint32> const first(auraType, 0);
+    std::pair<uint32, uint32> const last(auraType + 1, 0);
+    TotalsByMiscMask.erase(TotalsByMiscMask.lower_bound(first), TotalsByMiscMask.lower_bound(last));
+    MultipliersByMiscMask.erase(MultipliersByMiscMask.lower_bound(first), MultipliersByMiscMask.lower_bound(last));
 }
 
 // All aura base removes should go threw this function!
@@ -4920,6 +4948,7 @@ void Unit::RemoveOwnedAuras(uint32 spellId, std::function<bool(Aura const*)> con
         if (check(iter->second))
         {
             RemoveOwnedAura(iter);
+            iter = m_ownedAuras.lower_bound(spellId);
             continue;
         }
         ++iter;
@@ -4933,6 +4962,7 @@ void Unit::RemoveAppliedAuras(uint32 spellId, std::function<bool(AuraApplication
         if (check(iter->second))
         {
             RemoveAura(iter);
+            iter = m_appliedAuras.lower_bound(spellId);
             continue;
         }
         ++iter;
@@ -5216,18 +5246,27 @@ void Unit::RemoveAurasWithInterruptFlags(uint32 flag, uint32 except, bool isAuto
     if (!(m_interruptMask & flag))
         return;
 
-    // interrupt auras
-    for (AuraApplicationList::iterator iter = m_interruptableAuras.begin(); iter != m_interruptableAuras.end();)
+    // interrupt auras, by index as removals shift the following entries
+    for (std::size_t i = 0; i < m_interruptableAuras.size();)
     {
-        Aura* aura = (*iter)->GetBase();
-        ++iter;
+        AuraApplication* aurApp = m_interruptableAuras[i];
+        Aura* aura = aurApp->GetBase();
         if ((aura->GetSpellInfo()->AuraInterruptFlags & flag) && (!except || aura->GetId() != except))
         {
             uint32 removedAuras = m_removedAurasCount;
             RemoveAura(aura);
             if (m_removedAurasCount > removedAuras + 1)
-                iter = m_interruptableAuras.begin();
+            {
+                i = 0;
+                continue;
+            }
+
+            // the removed application was erased, the next one moved to its index
+            if (i < m_interruptableAuras.size() && m_interruptableAuras[i] != aurApp)
+                continue;
         }
+
+        ++i;
     }
 
     // interrupt channeled spell
@@ -5969,22 +6008,37 @@ int32 Unit::GetTotalAuraModifier(AuraType auratype) const
     if (mTotalAuraList.empty())
         return 0;
 
+    AuraModifierCache& cache = GetAuraModifierCache();
+    if (cache.TotalsValid.test(auratype))
+        return cache.Totals[auratype];
+
     int32 modifier = 0;
 
     for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
         modifier += (*i)->GetAmount();
 
+    cache.Totals[auratype] = modifier;
+    cache.TotalsValid.set(auratype);
     return modifier;
 }
 
 float Unit::GetTotalAuraMultiplier(AuraType auratype) const
 {
+    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
+    if (mTotalAuraList.empty())
+        return 1.0f;
+
+    AuraModifierCache& cache = GetAuraModifierCache();
+    if (cache.MultipliersValid.test(auratype))
+        return cache.Multipliers[auratype];
+
     float multiplier = 1.0f;
 
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
     for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
         AddPct(multiplier, (*i)->GetAmount());
 
+    cache.Multipliers[auratype] = multiplier;
+    cache.MultipliersValid.set(auratype);
     return multiplier;
 }
 
@@ -6016,29 +6070,56 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
+    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
+    if (mTotalAuraList.empty())
+        return 0;
+
+    AuraModifierCache& cache = GetAuraModifierCache();
+    auto cached = cache.TotalsByMiscMask.find({ auratype, misc_mask });
+    if (cached != cache.TotalsByMiscMask.end())
+        return cached->second;
+
     int32 modifier = 0;
 
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
     for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
     {
         if ((*i)->GetMiscValue()& misc_mask)
             modifier += (*i)->GetAmount();
     }
+
+    cache.TotalsByMiscMask.emplace(std::make_pair(uint32(auratype), misc_mask), modifier);
     return modifier;
 }
 
 float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
+    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
+    if (mTotalAuraList.empty())
+        return 1.0f;
+
+    AuraModifierCache& cache = GetAuraModifierCache();
+    auto cached = cache.MultipliersByMiscMask.find({ auratype, misc_mask });
+    if (cached != cache.MultipliersByMiscMask.end())
+        return cached->second;
+
     float multiplier = 1.0f;
 
-    AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
     for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
         if (((*i)->GetMiscValue() & misc_mask))
             AddPct(multiplier, (*i)->GetAmount());
 
+    cache.MultipliersByMiscMask.emplace(std::make_pair(uint32(auratype), misc_mask), multiplier);
     return multiplier;
 }
 
+AuraModifierCache& Unit::GetAuraModifierCache() const
+{
+    if (!m_auraModifierCache)
+        m_auraModifierCache = std::make_unique<AuraModifierCache>();
+
+    return *m_auraModifierCache;
+}
+
 int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask, const AuraEffect* except) const
 {
     int32 modifier = 0;
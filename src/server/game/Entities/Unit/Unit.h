@@ -29,10 +29,15 @@
 #include "SharedDefines.h"
 #include "SpellAuraDefines.h"
 #include "SpellDefines.h"
+#include "StableContainers.h"
 #include "ThreatMgr.h"
 #include "UnitDefines.h"
 #include "UnitUtils.h"
+#include <array>
+#include <bitset>
+#include <boost/container/flat_map.hpp>
 #include <functional>
+#include <memory>
 #include <utility>
 
 #define WORLD_TRIGGER   12999
@@ -587,6 +592,24 @@ struct AttackPosition {
     bool _taken;
 };
 
+// Aggregated aura modifier sums, rebuilt per aura type on demand and
+// invalidated whenever an effect of that type is (un)registered or its amount changes
+struct AuraModifierCache
+{
+    AuraModifierCache() { Totals.fill(0); Multipliers.fill(1.0f); }
+
+    void Invalidate(AuraType auraType);
+
+    std::array<int32, TOTAL_AURAS> Totals;
+    std::array<float, TOTAL_AURAS> Multipliers;
+    std::bitset<TOTAL_AURAS> TotalsValid;
+    std::bitset<TOTAL_AURAS> MultipliersValid;
+
+    // keyed by (aura type, misc mask)
+    boost::container::flat_map<std::pair<uint32, uint32>, int32> TotalsByMiscMask;
+    boost::container::flat_map<std::pair<uint32, uint32>, float> MultipliersByMiscMask;
+};
+
 // for clearing special attacks
 #define REACTIVE_TIMER_START 5000
 
@@ -622,24 +645,27 @@ public:
     typedef std::unordered_set<Unit*> AttackerSet;
     typedef std::set<Unit*> ControlSet;
 
-    typedef std::multimap<uint32,  Aura*> AuraMap;
+    // flat slot arrays with list-like iterator stability, erased slots are compacted in _UpdateSpells
+    typedef Acore::StableMultiMap<uint32, Aura*> AuraMap;
     typedef std::pair<AuraMap::const_iterator, AuraMap::const_iterator> AuraMapBounds;
     typedef std::pair<AuraMap::iterator, AuraMap::iterator> AuraMapBoundsNonConst;
 
-    typedef std::multimap<uint32,  AuraApplication*> AuraApplicationMap;
+    typedef Acore::StableMultiMap<uint32, AuraApplication*> AuraApplicationMap;
     typedef std::pair<AuraApplicationMap::const_iterator, AuraApplicationMap::const_iterator> AuraApplicationMapBounds;
     typedef std::pair<AuraApplicationMap::iterator, AuraApplicationMap::iterator> AuraApplicationMapBoundsNonConst;
 
     typedef std::multimap<AuraStateType,  AuraApplication*> AuraStateAurasMap;
     typedef std::pair<AuraStateAurasMap::const_iterator, AuraStateAurasMap::const_iterator> AuraStateAurasMapBounds;
 
-    typedef std::list<AuraEffect*> AuraEffectList;
-    typedef std::list<Aura*> AuraList;
-    typedef std::list<AuraApplication*> AuraApplicationList;
+    // GetAuraEffectsByType callers iterate it by reference while effects of the same type are applied and removed
+    typedef Acore::StableVector<AuraEffect*> AuraEffectList;
+    typedef std::vector<Aura*> AuraList;
+    typedef std::vector<AuraApplication*> AuraApplicationList;
     typedef std::list<DiminishingReturn> Diminishing;
     typedef GuidUnorderedSet ComboPointHolderSet;
 
-    typedef std::map<uint8, AuraApplication*> VisibleAuraMap;
+    // at most MAX_AURAS entries keyed by slot, kept contiguous for the per-tick client update walk
+    typedef boost::container::flat_map<uint8, AuraApplication*> VisibleAuraMap;
 
     ~Unit() override;
 
@@ -1289,6 +1315,7 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    void InvalidateAuraModifierCache(AuraType auraType) { if (m_auraModifierCache) m_auraModifierCache->Invalidate(auraType); }
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -2074,6 +2101,8 @@ protected:
     uint32 m_removedAurasCount;
 
     AuraEffectList m_modAuras[TOTAL_AURAS];
+    std::bitset<TOTAL_AURAS> m_modAurasToCompact;  // aura types with erased effects, compacted in _UpdateSpells
+    mutable std::unique_ptr<AuraModifierCache> m_auraModifierCache; // created on first aggregate query
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -2131,6 +2160,8 @@ private:
 
     [[nodiscard]] float processDummyAuras(float TakenTotalMod) const;
 
+    AuraModifierCache& GetAuraModifierCache() const;
+
     void _addAttacker(Unit* pAttacker) { m_attackers.insert(pAttacker); }   ///@note: Call only in Unit::Attack()
     void _removeAttacker(Unit* pAttacker) { m_attackers.erase(pAttacker); } ///@note: Call only in Unit::AttackStop()
 
@@ -1375,15 +1375,10 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
         {
             sObjectMgr->AddCreatureToGrid(*itr, data);
 
-            // Spawn if necessary (loaded grids only)
+            // Spawn if necessary (loaded grids only), done by the map itself spread over its next updates
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
-            // We use spawn coords to spawn
-            if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                Creature* creature = new Creature;
-                if (!creature->LoadCreatureFromDB(*itr, map))
-                    delete creature;
-            }
+            if (!map->Instanceable())
+                map->QueueGameEventSpawn(TYPEID_UNIT, *itr, eventId);
         }
     }
 
@@ -1400,22 +1395,11 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
         if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
         {
             sObjectMgr->AddGameobjectToGrid(*itr, data);
-            // Spawn if necessary (loaded grids only)
-            // this base map checked as non-instanced and then only existed
+
+            // Spawn if necessary (loaded grids only), done by the map itself spread over its next updates
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
-            // We use current coords to unspawn, not spawn coords since creature can have changed grid
-            if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                GameObject* pGameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
-                //TODO: find out when it is add to map
-                if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+            if (!map->Instanceable())
+                map->QueueGameEventSpawn(TYPEID_GAMEOBJECT, *itr, eventId);
         }
     }
 
@@ -28,6 +28,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "Transport.h"
+#include <array>
 
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
@@ -38,7 +39,12 @@ void HashMapHolder<T>::Insert(T* o)
 
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
-    GetContainer()[o->GetGUID()] = o;
+    GetMutableContainer()[o->GetGUID()] = o;
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_ptr<MapType> snapshot = shard.Owner ? std::make_unique<MapType>(*shard.Owner) : std::make_unique<MapType>();
+    (*snapshot)[o->GetGUID()] = o;
+    Publish(shard, std::move(snapshot));
 }
 
 template<class T>
@@ -46,20 +52,34 @@ void HashMapHolder<T>::Remove(T* o)
 {
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
-    GetContainer().erase(o->GetGUID());
+    if (!GetMutableContainer().erase(o->GetGUID()))
+        return;
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_ptr<MapType> snapshot = std::make_unique<MapType>(*shard.Owner);
+    snapshot->erase(o->GetGUID());
+    Publish(shard, std::move(snapshot));
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    MapType const* snapshot = GetShard(guid).Snapshot.load(std::memory_order_acquire);
+    if (!snapshot)
+        return nullptr;
+
+    typename MapType::const_iterator itr = snapshot->find(guid);
+    return (itr != snapshot->end()) ? itr->second : nullptr;
+}
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+template<class T>
+auto HashMapHolder<T>::GetContainer() -> MapType const&
+{
+    return GetMutableContainer();
 }
 
 template<class T>
-auto HashMapHolder<T>::GetContainer() -> MapType&
+auto HashMapHolder<T>::GetMutableContainer() -> MapType&
 {
     static MapType _objectMap;
     return _objectMap;
@@ -72,6 +92,40 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+auto HashMapHolder<T>::GetShard(ObjectGuid guid) -> Shard&
+{
+    static std::array<Shard, ShardCount> _shards;
+    return _shards[guid.GetCounter() % ShardCount];
+}
+
+template<class T>
+auto HashMapHolder<T>::GetRetiredSnapshots() -> std::vector<std::unique_ptr<MapType const>>&
+{
+    static std::vector<std::unique_ptr<MapType const>> _retiredSnapshots;
+    return _retiredSnapshots;
+}
+
+template<class T>
+void HashMapHolder<T>::Publish(Shard& shard, std::unique_ptr<MapType> snapshot)
+{
+    shard.Snapshot.store(snapshot.get(), std::memory_order_release);
+
+    // readers may still hold the previous snapshot until the next ReclaimRetiredSnapshots()
+    if (shard.Owner)
+        GetRetiredSnapshots().push_back(std::move(shard.Owner));
+
+    shard.Owner = std::move(snapshot);
+}
+
+template<class T>
+void HashMapHolder<T>::ReclaimRetiredSnapshots()
+{
+    std::unique_lock<std::shared_mutex> lock(*GetLock());
+
+    GetRetiredSnapshots().clear();
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
@@ -259,6 +313,12 @@ Player* ObjectAccessor::FindConnectedPlayer(ObjectGuid const guid)
     return HashMapHolder<Player>::Find(guid);
 }
 
+void ObjectAccessor::ReclaimRetiredSnapshots()
+{
+    HashMapHolder<Player>::ReclaimRetiredSnapshots();
+    HashMapHolder<MotionTransport>::ReclaimRetiredSnapshots();
+}
+
 void ObjectAccessor::SaveAllPlayers()
 {
     std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
@@ -19,9 +19,13 @@
 #define ACORE_OBJECTACCESSOR_H
 
 #include "Define.h"
+#include "FlatHashMap.h"
 #include "GridDefines.h"
 #include "Object.h"
+#include <atomic>
+#include <memory>
 #include <shared_mutex>
+#include <vector>
 
 class Creature;
 class Corpse;
@@ -36,6 +40,14 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 
+/**
+ * Global registry of objects that can be looked up from any map.
+ *
+ * Find() reads an immutable per shard snapshot without taking any lock, so lookups from
+ * map threads never write to a shared cache line. Insert() and Remove() copy the affected
+ * shard under GetLock() and publish the copy; the replaced snapshot is freed by
+ * ReclaimRetiredSnapshots() once no map thread can still be reading it.
+ */
 template <class T>
 class HashMapHolder
 {
@@ -44,7 +56,9 @@ class HashMapHolder
 
 public:
 
-    typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Acore::FlatHashMap<ObjectGuid, T*> MapType;
+
+    static constexpr std::size_t ShardCount = 32;
 
     static void Insert(T* o);
 
@@ -52,9 +66,28 @@ public:
 
     static T* Find(ObjectGuid guid);
 
-    static MapType& GetContainer();
+    // iterating requires GetLock() to be held
+    static MapType const& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+    // must only be called while no other thread can be inside Find()
+    static void ReclaimRetiredSnapshots();
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<MapType const*> Snapshot{nullptr};
+        std::unique_ptr<MapType const> Owner;
+    };
+
+    static MapType& GetMutableContainer();
+
+    static Shard& GetShard(ObjectGuid guid);
+
+    static std::vector<std::unique_ptr<MapType const>>& GetRetiredSnapshots();
+
+    static void Publish(Shard& shard, std::unique_ptr<MapType> snapshot);
 };
 
 namespace ObjectAccessor
@@ -99,6 +132,9 @@ namespace ObjectAccessor
 
     void SaveAllPlayers();
 
+    // frees global registry snapshots replaced since the last call, map threads must be idle
+    void ReclaimRetiredSnapshots();
+
     template<>
     void AddObject(Player* player);
 
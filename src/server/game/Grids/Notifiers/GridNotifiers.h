@@ -43,7 +43,7 @@ namespace Acore
     struct VisibleNotifier
     {
         Player& i_player;
-        GuidUnorderedSet vis_guids;
+        GuidFlatSet vis_guids;
         std::vector<Unit*>& i_visibleNow;
         bool i_gobjOnly;
         bool i_largeOnly;
@@ -100,6 +100,7 @@ namespace Acore
     {
         WorldObject const* i_source;
         WorldPacket const* i_message;
+        SharedWorldPacketPtr i_sharedMessage;           // created for the first receiver, reused by all others
         uint32 i_phaseMask;
         float i_distSq;
         TeamId teamId;
@@ -125,7 +126,10 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<SharedWorldPacket>(*i_message);
+
+            player->GetSession()->SendPacket(i_sharedMessage);
         }
     };
 
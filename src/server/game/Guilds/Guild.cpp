@@ -2120,26 +2120,29 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
+        SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(std::move(data));
         for (auto const& [guid, member] : m_members)
             if (Player* player = member.FindPlayer())
                 if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->GetSession()->SendPacket(&data);
+                    player->GetSession()->SendPacket(sharedData);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
+    SharedWorldPacketPtr sharedPacket = std::make_shared<SharedWorldPacket>(*packet);
     for (auto const& [guid, member] : m_members)
         if (member.IsRank(rankId))
             if (Player* player = member.FindPlayer())
-                player->GetSession()->SendPacket(packet);
+                player->GetSession()->SendPacket(sharedPacket);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
+    SharedWorldPacketPtr sharedPacket = std::make_shared<SharedWorldPacket>(*packet);
     for (auto const& [guid, member] : m_members)
         if (Player* player = member.FindPlayer())
-            player->GetSession()->SendPacket(packet);
+            player->GetSession()->SendPacket(sharedPacket);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -569,6 +569,8 @@ void Loot::AddItem(LootStoreItem const& item)
 // Calls processor of corresponding LootTemplate (which handles everything including references)
 bool Loot::FillLoot(uint32 lootId, LootStore const& store, Player* lootOwner, bool personal, bool noEmptyError, uint16 lootMode /*= LOOT_MODE_DEFAULT*/, WorldObject* lootSource /*= nullptr*/)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Loot);
+
     // Must be provided
     if (!lootOwner)
         return false;
@@ -1903,7 +1905,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
         {
             if ((*i)->itemid == uint32(cond->SourceEntry))
             {
-                (*i)->conditions.push_back(cond);
+                ConditionMgr::InsertCondition((*i)->conditions, cond);
                 return true;
             }
         }
@@ -1924,7 +1926,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::InsertCondition((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -1937,7 +1939,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::InsertCondition((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -20,6 +20,7 @@
 
 #include "ByteBuffer.h"
 #include "ConditionMgr.h"
+#include "MemoryTracker.h"
 #include "ObjectGuid.h"
 #include "RefMgr.h"
 #include "SharedDefines.h"
@@ -442,6 +443,8 @@ void LoadLootTemplates_Player();
 
 inline void LoadLootTables()
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Loot);
+
     LoadLootTemplates_Creature();
     LoadLootTemplates_Fishing();
     LoadLootTemplates_Gameobject();
@@ -21,6 +21,8 @@
 #include "Chat.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameEventMgr.h"
+#include "GameObjectAI.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
@@ -30,6 +32,7 @@
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MemoryTracker.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
@@ -43,9 +46,88 @@
 #include "Vehicle.h"
 #include "VMapMgr2.h"
 #include "Weather.h"
+#include "World.h"
+#include <bit>
 
 #define MAP_INVALID_ZONE        0xFFFFFFFF
 
+namespace
+{
+    std::atomic<uint64> LineOfSightGenerations{0};
+
+    uint64 NextLineOfSightGeneration()
+    {
+        return LineOfSightGenerations.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /**
+     * Line of sight results of the current map update.
+     *
+     * AoE target filtering, aggro and spell target checks test the same pairs of positions many times
+     * within one update. Results are keyed by the generation of the update that produced them, which is
+     * unique over all maps, and by both end points rounded to Resolution yards. Each thread keeps its own
+     * table, so cross-map checks from other threads need no locking.
+     */
+    class LineOfSightCache
+    {
+    public:
+        static constexpr float Resolution = 0.25f;
+
+        struct Key
+        {
+            uint64 Generation;
+            uint32 PhaseMask;
+            std::array<int32, 6> Coords;
+            uint8 Checks;
+            uint8 IgnoreFlags;
+
+            bool operator==(Key const&) const = default;
+        };
+
+        static Key MakeKey(uint64 generation, uint32 phaseMask, float x1, float y1, float z1, float x2, float y2, float z2, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags)
+        {
+            auto quantize = [](float value) { return int32(std::floor(value / Resolution)); };
+            return { generation, phaseMask, { quantize(x1), quantize(y1), quantize(z1), quantize(x2), quantize(y2), quantize(z2) }, uint8(checks), uint8(ignoreFlags) };
+        }
+
+        template<typename Check>
+        bool GetResult(Key const& key, Check&& check)
+        {
+            Entry& entry = _entries[GetSlot(key)];
+            if (entry.CacheKey == key)
+                return entry.Result;
+
+            bool result = check();
+            entry.CacheKey = key;
+            entry.Result = result;
+            return result;
+        }
+
+    private:
+        static constexpr std::size_t Size = 512;
+
+        struct Entry
+        {
+            Key CacheKey{ };   // generation 0 is never handed out
+            bool Result = false;
+        };
+
+        static std::size_t GetSlot(Key const& key)
+        {
+            uint32 hash = uint32(key.Generation) * 0x9E3779B1u ^ key.PhaseMask;
+            for (int32 coord : key.Coords)
+                hash = (hash ^ uint32(coord)) * 0x85EBCA77u;
+
+            hash ^= uint32(key.Checks) << 8 | key.IgnoreFlags;
+            return (hash ^ (hash >> 16)) % Size;
+        }
+
+        std::array<Entry, Size> _entries;
+    };
+
+    thread_local LineOfSightCache LineOfSightResults;
+}
+
 ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), WeatherId(WEATHER_STATE_FINE),
                                      WeatherGrade(0.0f), OverrideLightId(0), LightFadeInTime(0) { }
 
@@ -75,9 +157,11 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _mapGridManager(this), i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), _idleCreatureUpdateInterval(0), _deferredCreatureUpdates(0),
+    i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
 {
     m_parentMap = (_parent ? _parent : this);
+    _lineOfSightGeneration = NextLineOfSightGeneration();
 
     _zonePlayerCountMap.clear();
 
@@ -585,6 +669,11 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Map);
+
+    // line of sight results of the previous update may be stale now
+    InvalidateLineOfSight();
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
@@ -605,18 +694,36 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    // send the movement relayed while processing the sessions above as one packet per player
+    FlushMovementRelays();
+
     _creatureRespawnScheduler.Update(t_diff);
 
     if (!t_diff)
     {
         HandleDelayedVisibility();
+        FlushMovementRelays();
         return;
     }
 
+    ProcessGameEventSpawns();
+
     /// update active cells around players and active objects
     resetMarkedCells();
     resetMarkedCellsLarge();
 
+    // creatures out of combat and away from players may be updated at a reduced rate, see Creature::DeferIdleUpdate
+    if (IsBattlegroundOrArena())
+        _idleCreatureUpdateInterval = sWorld->getIntConfig(CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_BGARENAS);
+    else if (Instanceable())
+        _idleCreatureUpdateInterval = sWorld->getIntConfig(CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_INSTANCES);
+    else
+        _idleCreatureUpdateInterval = sWorld->getIntConfig(CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_CONTINENTS);
+
+    _deferredCreatureUpdates = 0;
+    if (_idleCreatureUpdateInterval)
+        MarkPlayerNearbyCells();
+
     // Prepare object updaters
     Acore::ObjectUpdater updater(t_diff, false);
 
@@ -719,6 +826,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    // relays queued by the object updates and scripts above must not wait for the next update
+    FlushMovementRelays();
+
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -726,6 +836,153 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_creatures_deferred", uint64(_deferredCreatureUpdates),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::RemoveGameObjectModel(const GameObjectModel& model)
+{
+    _dynamicTree.remove(model);
+    InvalidateLineOfSight();
+}
+
+void Map::InsertGameObjectModel(const GameObjectModel& model)
+{
+    _dynamicTree.insert(model);
+    InvalidateLineOfSight();
+}
+
+void Map::InvalidateLineOfSight()
+{
+    _lineOfSightGeneration.store(NextLineOfSightGeneration(), std::memory_order_relaxed);
+}
+
+void Map::FlushMovementRelays()
+{
+    if (!sWorld->getBoolConfig(CONFIG_AGGREGATE_MOVEMENT))
+        return;
+
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+        if (Player* player = itr->GetSource())
+            player->GetSession()->FlushMovementRelays();
+}
+
+void Map::QueueGameEventSpawn(TypeID typeId, ObjectGuid::LowType spawnId, int16 eventId)
+{
+    std::lock_guard<std::mutex> lock(_gameEventSpawnLock);
+    _gameEventSpawnQueue.push_back({ typeId, spawnId, eventId });
+}
+
+void Map::ProcessGameEventSpawns()
+{
+    uint32 budget = sWorld->getIntConfig(CONFIG_GAME_EVENT_SPAWN_BUDGET);
+    uint32 startTime = getMSTime();
+
+    std::unique_lock<std::mutex> lock(_gameEventSpawnLock);
+    if (_gameEventSpawnQueue.empty())
+        return;
+
+    while (!_gameEventSpawnQueue.empty() && (!budget || GetMSTimeDiffToNow(startTime) < budget))
+    {
+        GameEventSpawnEntry entry = _gameEventSpawnQueue.front();
+        _gameEventSpawnQueue.pop_front();
+
+        lock.unlock();
+        SpawnGameEventObject(entry);
+        lock.lock();
+    }
+
+    METRIC_VALUE("map_game_event_spawn_backlog", uint64(_gameEventSpawnQueue.size()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+void Map::SpawnGameEventObject(GameEventSpawnEntry const& entry)
+{
+    ObjectGuid::LowType spawnId = entry.SpawnId;
+
+    // objects spawned after the event started missed its GameEventMgr::RunSmartAIScripts call
+    bool runStartHook = entry.EventId > 0 && sGameEventMgr->IsActiveEvent(uint16(entry.EventId));
+
+    // the event may have been stopped again and the grid loaded (spawning it) since the spawn was queued
+    if (entry.TypeId == TYPEID_UNIT)
+    {
+        CreatureData const* data = sObjectMgr->GetCreatureData(spawnId);
+        if (!data || !IsGridLoaded(data->posX, data->posY))
+            return;
+
+        GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
+        if (!sObjectMgr->GetGridObjectGuids(GetId(), GetSpawnMode(), gridCoord.GetId()).creatures.count(spawnId))
+            return;
+
+        if (GetCreatureBySpawnIdStore().count(spawnId))
+            return;
+
+        Creature* creature = new Creature;
+        if (!creature->LoadCreatureFromDB(spawnId, this))
+        {
+            delete creature;
+            return;
+        }
+
+        if (runStartHook && creature->IsAIEnabled && creature->AI())
+            creature->AI()->sOnGameEvent(true, uint16(entry.EventId));
+    }
+    else if (entry.TypeId == TYPEID_GAMEOBJECT)
+    {
+        GameObjectData const* data = sObjectMgr->GetGameObjectData(spawnId);
+        if (!data || !IsGridLoaded(data->posX, data->posY))
+            return;
+
+        GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
+        if (!sObjectMgr->GetGridObjectGuids(GetId(), GetSpawnMode(), gridCoord.GetId()).gameobjects.count(spawnId))
+            return;
+
+        if (GetGameObjectBySpawnIdStore().count(spawnId))
+            return;
+
+        GameObject* gameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
+        if (!gameobject->LoadGameObjectFromDB(spawnId, this, false))
+        {
+            delete gameobject;
+            return;
+        }
+
+        if (gameobject->isSpawnedByDefault())
+            AddToMap(gameobject);
+
+        if (runStartHook && gameobject->IsInWorld() && gameobject->AI())
+            gameobject->AI()->OnGameEvent(true, uint16(entry.EventId));
+    }
+}
+
+void Map::MarkPlayerNearbyCells()
+{
+    _playerNearbyCells.reset();
+
+    float const range = float(sWorld->getIntConfig(CONFIG_IDLE_CREATURE_FULL_UPDATE_DISTANCE));
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld() || !player->IsPositionValid())
+            continue;
+
+        CellArea area = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), range);
+        for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+            for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+                _playerNearbyCells.set((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
+    }
+}
+
+bool Map::IsNearPlayers(float x, float y) const
+{
+    CellCoord p = Acore::ComputeCellCoord(x, y);
+    if (!p.IsCoordValid())
+        return false;
+
+    return _playerNearbyCells.test(p.GetId());
 }
 
 void Map::HandleDelayedVisibility()
@@ -1191,41 +1448,99 @@ Transport* Map::GetTransportForPos(uint32 phase, float x, float y, float z, Worl
     return nullptr;
 }
 
-float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+namespace
 {
-    // find raw .map surface under Z coordinates
-    float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    float gridHeight = GetGridHeight(x, y);
-    if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
-        mapHeight = gridHeight;
-
-    float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    if (checkVMap)
+    // selects between the raw .map surface and the vmap floor found under z
+    float SelectSurfaceHeight(float z, float gridHeight, float vmapHeight)
     {
-        VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
-        vmapHeight = vmgr->getHeight(GetId(), x, y, z, maxSearchDist);   // look from a bit higher pos to find the floor
-    }
+        // find raw .map surface under Z coordinates
+        float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
+        if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
+            mapHeight = gridHeight;
 
-    // mapHeight set for any above raw ground Z or <= INVALID_HEIGHT
-    // vmapheight set for any under Z value or <= INVALID_HEIGHT
-    if (vmapHeight > INVALID_HEIGHT)
-    {
-        if (mapHeight > INVALID_HEIGHT)
+        // mapHeight set for any above raw ground Z or <= INVALID_HEIGHT
+        // vmapheight set for any under Z value or <= INVALID_HEIGHT
+        if (vmapHeight > INVALID_HEIGHT)
         {
-            // we have mapheight and vmapheight and must select more appropriate
+            if (mapHeight > INVALID_HEIGHT)
+            {
+                // we have mapheight and vmapheight and must select more appropriate
 
-            // we are already under the surface or vmap height above map heigt
-            // or if the distance of the vmap height is less the land height distance
-            if (vmapHeight > mapHeight || std::fabs(mapHeight - z) > std::fabs(vmapHeight - z))
-                return vmapHeight;
+                // we are already under the surface or vmap height above map heigt
+                // or if the distance of the vmap height is less the land height distance
+                if (vmapHeight > mapHeight || std::fabs(mapHeight - z) > std::fabs(vmapHeight - z))
+                    return vmapHeight;
+                else
+                    return mapHeight;                           // better use .map surface height
+            }
             else
-                return mapHeight;                           // better use .map surface height
+                return vmapHeight;                              // we have only vmapHeight (if have)
         }
-        else
-            return vmapHeight;                              // we have only vmapHeight (if have)
+
+        return mapHeight;                               // explicitly use map data
     }
 
-    return mapHeight;                               // explicitly use map data
+    /**
+     * Recent vmap floor probes of the current thread.
+     *
+     * Idle and random moving creatures, respawns and ground targeted spells probe the same
+     * coordinates over and over. The vmap models are shared by all instances of a map id, so
+     * results are keyed by map id and the exact probe, and kept per thread as maps of the same
+     * id are updated in parallel.
+     */
+    class VMapHeightCache
+    {
+    public:
+        float GetHeight(uint32 mapId, float x, float y, float z, float maxSearchDist)
+        {
+            Entry& entry = _entries[GetSlot(mapId, x, y, z)];
+            if (entry.MapId == mapId && entry.X == x && entry.Y == y && entry.Z == z && entry.MaxSearchDist == maxSearchDist)
+                return entry.Height;
+
+            float height = VMAP::VMapFactory::createOrGetVMapMgr()->getHeight(mapId, x, y, z, maxSearchDist);
+
+            // tiles may not be loaded yet, only floors that were found are remembered
+            if (height > INVALID_HEIGHT)
+                entry = { mapId, x, y, z, maxSearchDist, height };
+
+            return height;
+        }
+
+    private:
+        static constexpr std::size_t Size = 512;
+
+        struct Entry
+        {
+            uint32 MapId = std::numeric_limits<uint32>::max();
+            float X = 0.0f;
+            float Y = 0.0f;
+            float Z = 0.0f;
+            float MaxSearchDist = 0.0f;
+            float Height = 0.0f;
+        };
+
+        static std::size_t GetSlot(uint32 mapId, float x, float y, float z)
+        {
+            uint32 hash = mapId;
+            hash = (hash ^ std::bit_cast<uint32>(x)) * 0x9E3779B1u;
+            hash = (hash ^ std::bit_cast<uint32>(y)) * 0x85EBCA77u;
+            hash = (hash ^ std::bit_cast<uint32>(z)) * 0xC2B2AE3Du;
+            return (hash ^ (hash >> 16)) % Size;
+        }
+
+        std::array<Entry, Size> _entries;
+    };
+
+    thread_local VMapHeightCache VMapHeights;
+}
+
+float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
+    if (checkVMap)
+        vmapHeight = VMapHeights.GetHeight(GetId(), x, y, z, maxSearchDist);   // look from a bit higher pos to find the floor
+
+    return SelectSurfaceHeight(z, GetGridHeight(x, y), vmapHeight);
 }
 
 float Map::GetGridHeight(float x, float y) const
@@ -1607,26 +1922,30 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
         }
     }
 
-    if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
-    {
-        return false;
-    }
-
-    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    LineOfSightCache::Key key = LineOfSightCache::MakeKey(_lineOfSightGeneration.load(std::memory_order_relaxed), phasemask, x1, y1, z1, x2, y2, z2, checks, ignoreFlags);
+    return LineOfSightResults.GetResult(key, [&]()
     {
-        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
-        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
         {
-            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+            return false;
         }
 
-        if (!_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, ignoreFlags))
+        if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
         {
-            return false;
+            VMAP::ModelIgnoreFlags gameObjectIgnoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+            if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+            {
+                gameObjectIgnoreFlags = VMAP::ModelIgnoreFlags::M2;
+            }
+
+            if (!_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, gameObjectIgnoreFlags))
+            {
+                return false;
+            }
         }
-    }
 
-    return true;
+        return true;
+    });
 }
 
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
@@ -1651,6 +1970,20 @@ float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=tr
     return std::max<float>(h1, h2);
 }
 
+void Map::GetHeights(uint32 phasemask, float x, float y, float const* z, float* heights, std::size_t count, bool vmap/*=true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    // the terrain under x, y is the same for all probes
+    float gridHeight = GetGridHeight(x, y);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
+        if (vmap)
+            vmapHeight = VMapHeights.GetHeight(GetId(), x, y, z[i], maxSearchDist);
+
+        heights[i] = std::max<float>(SelectSurfaceHeight(z[i], gridHeight, vmapHeight), _dynamicTree.getHeight(x, y, z[i], maxSearchDist, phasemask));
+    }
+}
+
 bool Map::IsInWater(uint32 phaseMask, float x, float y, float pZ, float collisionHeight) const
 {
     LiquidData const& liquidData = const_cast<Map*>(this)->GetLiquidData(phaseMask, x, y, pZ, collisionHeight, MAP_ALL_LIQUIDS);
@@ -1739,7 +2072,7 @@ void Map::SendRemoveTransports(Player* player)
             (*itr)->BuildOutOfRangeUpdateBlock(&transData);
 
     // pussywizard: remove static transports from client
-    for (GuidUnorderedSet::const_iterator it = player->m_clientGUIDs.begin(); it != player->m_clientGUIDs.end(); )
+    for (GuidFlatSet::const_iterator it = player->m_clientGUIDs.begin(); it != player->m_clientGUIDs.end(); )
     {
         if ((*it).IsTransport())
         {
@@ -1935,8 +2268,12 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    if (m_mapRefMgr.IsEmpty())
+        return;
+
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(sharedData);
 }
 
 template<class T>
@@ -35,9 +35,12 @@
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "GridTerrainData.h"
+#include <atomic>
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 
 class Unit;
@@ -321,6 +324,14 @@ public:
     bool isCellMarkedLarge(uint32 pCellId) { return marked_cells_large.test(pCellId); }
     void markCellLarge(uint32 pCellId) { marked_cells_large.set(pCellId); }
 
+    // Idle creature update throttling, 0 interval means every creature is updated each tick
+    [[nodiscard]] uint32 GetIdleCreatureUpdateInterval() const { return _idleCreatureUpdateInterval; }
+    [[nodiscard]] bool IsNearPlayers(float x, float y) const;
+    void AddDeferredCreatureUpdate() { ++_deferredCreatureUpdates; }
+
+    // Spawns of started game events, applied during Update within MapUpdate.GameEventSpawnBudget
+    void QueueGameEventSpawn(TypeID typeId, ObjectGuid::LowType spawnId, int16 eventId);
+
     [[nodiscard]] bool HavePlayers() const { return !m_mapRefMgr.IsEmpty(); }
     [[nodiscard]] uint32 GetPlayersCountExceptGMs() const;
 
@@ -398,15 +409,19 @@ public:
 
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+    // height under several z probes at the same x, y, the terrain is only looked up once
+    void GetHeights(uint32 phasemask, float x, float y, float const* z, float* heights, std::size_t count, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
     void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+    void RemoveGameObjectModel(const GameObjectModel& model);
+    void InsertGameObjectModel(const GameObjectModel& model);
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
+    // Drops the cached line of sight results, needed whenever gameobject collision changes
+    void InvalidateLineOfSight();
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
@@ -548,6 +563,7 @@ protected:
     uint32 m_unloadTimer;
     float m_VisibleDistance;
     DynamicMapTree _dynamicTree;
+    std::atomic<uint64> _lineOfSightGeneration;   // bumped every update and on collision changes, keys the line of sight cache
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -577,6 +593,25 @@ private:
 
     std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
     std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells_large;
+    std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP> _playerNearbyCells;
+    uint32 _idleCreatureUpdateInterval;
+    uint32 _deferredCreatureUpdates;
+
+    void MarkPlayerNearbyCells();
+    void FlushMovementRelays();
+
+    struct GameEventSpawnEntry
+    {
+        TypeID TypeId;
+        ObjectGuid::LowType SpawnId;
+        int16 EventId;      // negative for objects spawned when the event stops
+    };
+
+    void ProcessGameEventSpawns();
+    void SpawnGameEventObject(GameEventSpawnEntry const& entry);
+
+    std::mutex _gameEventSpawnLock;
+    std::deque<GameEventSpawnEntry> _gameEventSpawnQueue;
 
     bool i_scriptLock;
     std::unordered_set<WorldObject*> i_objectsToRemove;
@@ -20,6 +20,7 @@
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "MapMgr.h"
+#include "MemoryTracker.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -179,6 +180,8 @@ Map* MapInstanced::CreateInstanceForPlayer(const uint32 mapId, Player* player)
 
 InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Map);
+
     // load/create a map
     std::lock_guard<std::mutex> guard(Lock);
 
@@ -233,6 +236,8 @@ InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save,
 
 BattlegroundMap* MapInstanced::CreateBattleground(uint32 InstanceId, Battleground* bg)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Map);
+
     // load/create a map
     std::lock_guard<std::mutex> guard(Lock);
 
@@ -26,6 +26,7 @@
 #include "Language.h"
 #include "Log.h"
 #include "MapInstanced.h"
+#include "MemoryTracker.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -69,6 +70,8 @@ void MapMgr::InitializeVisibilityDistanceInfo()
 
 Map* MapMgr::CreateBaseMap(uint32 id)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::Map);
+
     Map* map = FindBaseMap(id);
 
     if (!map)
@@ -48,7 +48,7 @@ public:
 
     [[nodiscard]] virtual bool IsRealmCompleted(AchievementGlobalMgr const* /*globalmgr*/, AchievementEntry const* /*achievement*/, SystemTimePoint /*completionTime*/) { return true; }
 
-    virtual void OnBeforeCheckCriteria(AchievementMgr* /*mgr*/, std::list<AchievementCriteriaEntry const*> const* /*achievementCriteriaList*/) { }
+    virtual void OnBeforeCheckCriteria(AchievementMgr* /*mgr*/, std::vector<AchievementCriteriaEntry const*> const* /*achievementCriteriaList*/) { }
 
     [[nodiscard]] virtual bool CanCheckCriteria(AchievementMgr* /*mgr*/, AchievementCriteriaEntry const* /*achievementCriteria*/) { return true; }
 };
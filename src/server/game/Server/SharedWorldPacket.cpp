@@ -0,0 +1,114 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedWorldPacket.h"
+#include "Log.h"
+#include "World.h"
+#include "zlib.h"
+
+namespace
+{
+    void compressBuff(void* dst, uint32* dst_size, void const* src, int src_size)
+    {
+        z_stream c_stream;
+
+        c_stream.zalloc = (alloc_func)0;
+        c_stream.zfree = (free_func)0;
+        c_stream.opaque = (voidpf)0;
+
+        // default Z_BEST_SPEED (1)
+        int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
+        if (z_res != Z_OK)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+            *dst_size = 0;
+            return;
+        }
+
+        c_stream.next_out = (Bytef*)dst;
+        c_stream.avail_out = *dst_size;
+        c_stream.next_in = (Bytef*)src;
+        c_stream.avail_in = (uInt)src_size;
+
+        z_res = deflate(&c_stream, Z_NO_FLUSH);
+        if (z_res != Z_OK)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
+            *dst_size = 0;
+            return;
+        }
+
+        if (c_stream.avail_in != 0)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
+            *dst_size = 0;
+            return;
+        }
+
+        z_res = deflate(&c_stream, Z_FINISH);
+        if (z_res != Z_STREAM_END)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
+            *dst_size = 0;
+            return;
+        }
+
+        z_res = deflateEnd(&c_stream);
+        if (z_res != Z_OK)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
+            *dst_size = 0;
+            return;
+        }
+
+        *dst_size = c_stream.total_out;
+    }
+}
+
+WorldPacket const& SharedWorldPacket::GetWirePacket() const
+{
+    if (!NeedsCompression(_packet))
+        return _packet;
+
+    // sockets of the same broadcast may be flushed from different network threads
+    std::call_once(_compressFlag, [this]() { _compressed = Compress(_packet); });
+
+    return _compressed ? *_compressed : _packet;
+}
+
+std::optional<WorldPacket> SharedWorldPacket::Compress(WorldPacket const& packet)
+{
+    if (!NeedsCompression(packet))
+        return std::nullopt;
+
+    // SMSG_MULTIPLE_MOVES already starts with the uncompressed size SMSG_COMPRESSED_MOVES expects
+    bool moves = packet.GetOpcode() == SMSG_MULTIPLE_MOVES;
+    uint32 offset = moves ? sizeof(uint32) : 0;
+    uint32 pSize = packet.size() - offset;
+
+    uint32 destsize = compressBound(pSize);
+    WorldPacket buf(moves ? SMSG_COMPRESSED_MOVES : SMSG_COMPRESSED_UPDATE_OBJECT, destsize + sizeof(uint32));
+    buf.resize(destsize + sizeof(uint32));
+
+    buf.put<uint32>(0, pSize);
+    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, packet.contents() + offset, pSize);
+    if (destsize == 0)
+        return std::nullopt;
+
+    buf.resize(destsize + sizeof(uint32));
+    return buf;
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SHAREDWORLDPACKET_H_
+#define _SHAREDWORLDPACKET_H_
+
+#include "WorldPacket.h"
+#include <memory>
+#include <mutex>
+#include <optional>
+
+/// Immutable outgoing packet that can be queued on any number of sockets.
+/// The payload is copied once when the packet is created and compressed at most once,
+/// each socket only builds and encrypts its own header for it.
+class AC_GAME_API SharedWorldPacket
+{
+public:
+    explicit SharedWorldPacket(WorldPacket const& packet) : _packet(packet) { }
+    explicit SharedWorldPacket(WorldPacket&& packet) : _packet(std::move(packet)) { }
+
+    SharedWorldPacket(SharedWorldPacket const&) = delete;
+    SharedWorldPacket& operator=(SharedWorldPacket const&) = delete;
+
+    /// Packet as built by the game, used for script hooks and packet logging
+    WorldPacket const& GetPacket() const { return _packet; }
+
+    /// Packet as it is written to the socket, compressed on first use when worth it
+    WorldPacket const& GetWirePacket() const;
+
+    /// Compressed form of a packet, empty when the packet is not worth compressing or compression failed
+    static std::optional<WorldPacket> Compress(WorldPacket const& packet);
+
+private:
+    static bool NeedsCompression(WorldPacket const& packet) { return (packet.GetOpcode() == SMSG_UPDATE_OBJECT || packet.GetOpcode() == SMSG_MULTIPLE_MOVES) && packet.size() > 100; }
+
+    WorldPacket const _packet;
+    mutable std::once_flag _compressFlag;
+    mutable std::optional<WorldPacket> _compressed;
+};
+
+typedef std::shared_ptr<SharedWorldPacket const> SharedWorldPacketPtr;
+
+#endif
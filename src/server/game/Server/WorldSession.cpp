@@ -33,6 +33,7 @@
 #include "Hyperlinks.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "MemoryTracker.h"
 #include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -58,6 +59,83 @@
 namespace
 {
     std::string const DefaultPlayerName = "<none>";
+
+#if defined(ACORE_DEBUG)
+    void LogSendStatistics(WorldPacket const& packet)
+    {
+        // Code for network use statistic
+        static uint64 sendPacketCount = 0;
+        static uint64 sendPacketBytes = 0;
+
+        static time_t firstTime = GameTime::GetGameTime().count();
+        static time_t lastTime = firstTime;                 // next 60 secs start time
+
+        static uint64 sendLastPacketCount = 0;
+        static uint64 sendLastPacketBytes = 0;
+
+        time_t cur_time = GameTime::GetGameTime().count();
+
+        if ((cur_time - lastTime) < 60)
+        {
+            sendPacketCount += 1;
+            sendPacketBytes += packet.size();
+
+            sendLastPacketCount += 1;
+            sendLastPacketBytes += packet.size();
+        }
+        else
+        {
+            uint64 minTime = uint64(cur_time - lastTime);
+            uint64 fullTime = uint64(lastTime - firstTime);
+
+            LOG_DEBUG("network", "Send all time packets count: {} bytes: {} avr.count/sec: {} avr.bytes/sec: {} time: {}", sendPacketCount, sendPacketBytes, float(sendPacketCount) / fullTime, float(sendPacketBytes) / fullTime, uint32(fullTime));
+
+            LOG_DEBUG("network", "Send last min packets count: {} bytes: {} avr.count/sec: {} avr.bytes/sec: {}", sendLastPacketCount, sendLastPacketBytes, float(sendLastPacketCount) / minTime, float(sendLastPacketBytes) / minTime);
+
+            lastTime = cur_time;
+            sendLastPacketCount = 1;
+            sendLastPacketBytes = packet.wpos();            // wpos is real written size
+        }
+    }
+#endif
+
+    // the size of a SMSG_MULTIPLE_MOVES entry is an uint8 including the opcode
+    constexpr std::size_t MaxMovementRelaySize = 0xFF - sizeof(uint16);
+
+    // movement relays of HandleMovementOpcodes that can be sent inside SMSG_MULTIPLE_MOVES
+    bool IsAggregatableMovementOpcode(uint16 opcode)
+    {
+        switch (opcode)
+        {
+            case MSG_MOVE_START_FORWARD:
+            case MSG_MOVE_START_BACKWARD:
+            case MSG_MOVE_STOP:
+            case MSG_MOVE_START_STRAFE_LEFT:
+            case MSG_MOVE_START_STRAFE_RIGHT:
+            case MSG_MOVE_STOP_STRAFE:
+            case MSG_MOVE_JUMP:
+            case MSG_MOVE_START_TURN_LEFT:
+            case MSG_MOVE_START_TURN_RIGHT:
+            case MSG_MOVE_STOP_TURN:
+            case MSG_MOVE_START_PITCH_UP:
+            case MSG_MOVE_START_PITCH_DOWN:
+            case MSG_MOVE_STOP_PITCH:
+            case MSG_MOVE_SET_RUN_MODE:
+            case MSG_MOVE_SET_WALK_MODE:
+            case MSG_MOVE_FALL_LAND:
+            case MSG_MOVE_START_SWIM:
+            case MSG_MOVE_STOP_SWIM:
+            case MSG_MOVE_SET_FACING:
+            case MSG_MOVE_SET_PITCH:
+            case MSG_MOVE_HEARTBEAT:
+            case MSG_MOVE_START_ASCEND:
+            case MSG_MOVE_STOP_ASCEND:
+            case MSG_MOVE_START_DESCEND:
+                return true;
+            default:
+                return false;
+        }
+    }
 }
 
 bool MapSessionFilter::Process(WorldPacket* packet)
@@ -135,6 +213,8 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _addonMessageReceiveCount(0),
     _timeSyncClockDeltaQueue(6),
     _timeSyncClockDelta(0),
+    _movementRelays(0),
+    _movementRelayCount(0),
     _pendingTimeSyncRequests()
 {
     memset(m_Tutorials, 0, sizeof(m_Tutorials));
@@ -229,47 +309,93 @@ void WorldSession::SendPacket(WorldPacket const* packet)
         return;
 
 #if defined(ACORE_DEBUG)
-    // Code for network use statistic
-    static uint64 sendPacketCount = 0;
-    static uint64 sendPacketBytes = 0;
+    LogSendStatistics(*packet);
+#endif
 
-    static time_t firstTime = GameTime::GetGameTime().count();
-    static time_t lastTime = firstTime;                     // next 60 secs start time
+    if (!sScriptMgr->CanPacketSend(this, *packet))
+    {
+        return;
+    }
 
-    static uint64 sendLastPacketCount = 0;
-    static uint64 sendLastPacketBytes = 0;
+    if (QueueMovementRelay(*packet))
+        return;
 
-    time_t cur_time = GameTime::GetGameTime().count();
+    m_Socket->SendPacket(*packet);
+}
 
-    if ((cur_time - lastTime) < 60)
-    {
-        sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+/// Send a packet that is queued unchanged on many sessions, the payload is not copied per session
+void WorldSession::SendPacket(SharedWorldPacketPtr const& packet)
+{
+    if (!m_Socket)
+        return;
 
-        sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
-    }
-    else
-    {
-        uint64 minTime = uint64(cur_time - lastTime);
-        uint64 fullTime = uint64(lastTime - firstTime);
+#if defined(ACORE_DEBUG)
+    LogSendStatistics(packet->GetPacket());
+#endif
+
+    if (!sScriptMgr->CanPacketSend(this, packet->GetPacket()))
+        return;
+
+    if (QueueMovementRelay(packet->GetPacket()))
+        return;
 
-        LOG_DEBUG("network", "Send all time packets count: {} bytes: {} avr.count/sec: {} avr.bytes/sec: {} time: {}", sendPacketCount, sendPacketBytes, float(sendPacketCount) / fullTime, float(sendPacketBytes) / fullTime, uint32(fullTime));
+    m_Socket->SendPacket(packet);
+}
 
-        LOG_DEBUG("network", "Send last min packets count: {} bytes: {} avr.count/sec: {} avr.bytes/sec: {}", sendLastPacketCount, sendLastPacketBytes, float(sendLastPacketCount) / minTime, float(sendLastPacketBytes) / minTime);
+/// Buffers movement relays of other units until FlushMovementRelays(), returns false if the packet has to be sent now
+bool WorldSession::QueueMovementRelay(WorldPacket const& packet)
+{
+    if (!sWorld->getBoolConfig(CONFIG_AGGREGATE_MOVEMENT))
+        return false;
 
-        lastTime = cur_time;
-        sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos();               // wpos is real written size
+    uint16 opcode = packet.GetOpcode();
+    if (!IsAggregatableMovementOpcode(opcode) || packet.size() > MaxMovementRelaySize)
+    {
+        // nothing may overtake the buffered relays, e.g. speed changes, splines, teleports or object updates
+        FlushMovementRelays();
+        return false;
     }
-#endif                                                      // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet))
+    std::lock_guard<std::mutex> lock(_movementRelayLock);
+    _movementRelays << uint8(packet.size() + sizeof(uint16));
+    _movementRelays << uint16(opcode);
+    if (!packet.empty())
+        _movementRelays.append(packet.contents(), packet.size());
+
+    ++_movementRelayCount;
+    return true;
+}
+
+void WorldSession::FlushMovementRelays()
+{
+    std::unique_ptr<WorldPacket> packet;
+
     {
-        return;
+        std::lock_guard<std::mutex> lock(_movementRelayLock);
+        if (!_movementRelayCount)
+            return;
+
+        if (_movementRelayCount == 1)
+        {
+            // a single relay is sent as it was built
+            std::size_t const headerSize = sizeof(uint8) + sizeof(uint16);
+            packet = std::make_unique<WorldPacket>(_movementRelays.read<uint16>(sizeof(uint8)), _movementRelays.size() - headerSize);
+            if (_movementRelays.size() > headerSize)
+                packet->append(_movementRelays.contents() + headerSize, _movementRelays.size() - headerSize);
+        }
+        else
+        {
+            packet = std::make_unique<WorldPacket>(SMSG_MULTIPLE_MOVES, sizeof(uint32) + _movementRelays.size());
+            *packet << uint32(_movementRelays.size());
+            packet->append(_movementRelays);
+        }
+
+        _movementRelays.clear();
+        _movementRelayCount = 0;
     }
 
-    m_Socket->SendPacket(*packet);
+    if (m_Socket)
+        m_Socket->SendPacket(std::move(*packet));
 }
 
 /// Add an incoming packet to the queue
@@ -300,6 +426,8 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 {
+    Acore::MemoryTagScope memoryTag(MemoryTag::WorldSession);
+
     ///- Before we process anything:
     /// If necessary, kick the player because the client didn't send anything for too long
     /// (or they've been idling in character select)
@@ -503,6 +631,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     ProcessQueryCallbacks();
 
+    // sessions of players on a map are flushed by Map::Update
+    if (updater.ProcessUnsafe())
+        FlushMovementRelays();
+
     //check if we are safe to proceed with logout
     //logout procedure should happen only in World::UpdateSessions() method!!!
     if (updater.ProcessUnsafe())
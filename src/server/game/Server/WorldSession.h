@@ -31,9 +31,11 @@
 #include "GossipDef.h"
 #include "Packet.h"
 #include "SharedDefines.h"
+#include "SharedWorldPacket.h"
 #include "World.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 class Creature;
@@ -346,6 +348,10 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(SharedWorldPacketPtr const& packet);
+
+    /// Sends the movement relays collected since the last call, see Network.AggregateMovement
+    void FlushMovementRelays();
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -1196,6 +1202,13 @@ private:
     int64 _timeSyncClockDelta;
     void ComputeNewClockDelta();
 
+    bool QueueMovementRelay(WorldPacket const& packet);
+
+    // entries of SMSG_MULTIPLE_MOVES: uint8 size, uint16 opcode, payload
+    std::mutex _movementRelayLock;
+    ByteBuffer _movementRelays;
+    uint32 _movementRelayCount;
+
     std::map<uint32, uint32> _pendingTimeSyncRequests; // key: counter. value: server time when packet with that counter was sent.
     uint32 _timeSyncNextCounter;
     uint32 _timeSyncTimer;
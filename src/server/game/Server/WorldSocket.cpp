@@ -31,89 +31,22 @@
 #include "World.h"
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
-#include "zlib.h"
 #include <memory>
 
 #include "ServerPktHeader.h"
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
+WorldPacket const& EncryptablePacket::GetPacket()
 {
-    z_stream c_stream;
+    if (SharedWorldPacketPtr const* sharedPacket = std::get_if<SharedWorldPacketPtr>(&_packet))
+        return (*sharedPacket)->GetWirePacket();
 
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+    WorldPacket& packet = std::get<WorldPacket>(_packet);
+    if (std::optional<WorldPacket> compressed = SharedWorldPacket::Compress(packet))
+        packet = std::move(*compressed);
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
-
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    if (c_stream.avail_in != 0)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
-        *dst_size = 0;
-        return;
-    }
-
-    z_res = deflate(&c_stream, Z_FINISH);
-    if (z_res != Z_STREAM_END)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
-}
-
-void EncryptableAndCompressiblePacket::CompressIfNeeded()
-{
-    if (!NeedsCompression())
-        return;
-
-    uint32 pSize = size();
-
-    uint32 destsize = compressBound(pSize);
-    ByteBuffer buf(destsize + sizeof(uint32));
-    buf.resize(destsize + sizeof(uint32));
-
-    buf.put<uint32>(0, pSize);
-    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
-    if (destsize == 0)
-        return;
-
-    buf.resize(destsize + sizeof(uint32));
-
-    ByteBuffer::operator=(std::move(buf));
-    SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    return packet;
 }
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
@@ -163,7 +96,7 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 
 bool WorldSocket::Update()
 {
-    EncryptableAndCompressiblePacket* queued;
+    EncryptablePacket* queued;
     if (_bufferQueue.Dequeue(queued))
     {
         // Allocate buffer only when it's needed but not on every Update() call.
@@ -171,12 +104,12 @@ bool WorldSocket::Update()
         std::size_t currentPacketSize;
         do
         {
-            queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& packet = queued->GetPacket();
+            ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            currentPacketSize = packet.size() + header.getHeaderLength();
 
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
@@ -187,8 +120,8 @@ bool WorldSocket::Update()
             if (buffer.GetRemainingSpace() >= currentPacketSize)
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
             else    // Single packet larger than current buffer size
             {
@@ -200,8 +133,8 @@ bool WorldSocket::Update()
                     _sendBufferSize = currentPacketSize;
 
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
 
             delete queued;
@@ -514,6 +447,14 @@ void WorldSocket::SendPacketAndLogOpcode(WorldPacket const& packet)
 }
 
 void WorldSocket::SendPacket(WorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    SendPacket(WorldPacket(packet));
+}
+
+void WorldSocket::SendPacket(WorldPacket&& packet)
 {
     if (!IsOpen())
         return;
@@ -521,7 +462,18 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::SendPacket(SharedWorldPacketPtr packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(packet->GetPacket(), SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
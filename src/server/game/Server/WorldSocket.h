@@ -21,31 +21,39 @@
 #include "AuthCrypt.h"
 #include "Common.h"
 #include "MPSCQueue.h"
+#include "SharedWorldPacket.h"
 #include "Socket.h"
 #include "Util.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <variant>
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+/// Per-socket queue entry, owning a unicast packet or referencing a payload shared with other sockets
+class EncryptablePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptablePacket(WorldPacket&& packet, bool encrypt) : _packet(std::in_place_type<WorldPacket>, std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
-    bool NeedsEncryption() const { return _encrypt; }
+    EncryptablePacket(SharedWorldPacketPtr packet, bool encrypt) : _packet(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    /// Packet as it is written to the socket, an owned packet is compressed in place when worth it
+    WorldPacket const& GetPacket();
 
-    void CompressIfNeeded();
+    bool NeedsEncryption() const { return _encrypt; }
 
-    std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
+    std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::variant<WorldPacket, SharedWorldPacketPtr> _packet;
     bool _encrypt;
 };
 
@@ -82,6 +90,8 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(WorldPacket&& packet);
+    void SendPacket(SharedWorldPacketPtr packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -128,7 +138,7 @@ private:
 
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
-    MPSCQueue<EncryptableAndCompressiblePacket, &EncryptableAndCompressiblePacket::SocketQueueLink> _bufferQueue;
+    MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
     std::size_t _sendBufferSize;
 
     QueryCallbackProcessor _queryProcessor;
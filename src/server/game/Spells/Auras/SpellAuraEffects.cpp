@@ -430,6 +430,25 @@ void AuraEffect::GetApplicationList(std::list<AuraApplication*>& applicationList
     }
 }
 
+void AuraEffect::SetAmount(int32 amount)
+{
+    m_amount = amount;
+    m_canBeRecalculated = false;
+    InvalidateTargetModifierCaches();
+}
+
+void AuraEffect::SetEnabled(bool enabled)
+{
+    m_isAuraEnabled = enabled;
+    InvalidateTargetModifierCaches();
+}
+
+void AuraEffect::InvalidateTargetModifierCaches()
+{
+    for (auto const& [guid, aurApp] : GetBase()->GetApplicationMap())
+        aurApp->GetTarget()->InvalidateAuraModifierCache(GetAuraType());
+}
+
 uint32 AuraEffect::GetId() const
 {
     return m_spellInfo->Id;
@@ -734,7 +753,10 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
     if (handleMask & AURA_EFFECT_HANDLE_CHANGE_AMOUNT)
     {
         if (!mark)
+        {
             m_amount = newAmount;
+            InvalidateTargetModifierCaches();
+        }
         else
             SetAmount(newAmount);
         CalculateSpellMod();
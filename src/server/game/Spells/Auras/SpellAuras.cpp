@@ -23,6 +23,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -463,6 +464,21 @@ Aura::~Aura()
     _DeleteRemovedApplications();
 }
 
+namespace
+{
+    Acore::ObjectPool AuraPool("Aura");
+}
+
+void* Aura::operator new(std::size_t size)
+{
+    return AuraPool.Allocate(size);
+}
+
+void Aura::operator delete(void* ptr, std::size_t size)
+{
+    AuraPool.Deallocate(ptr, size);
+}
+
 uint32 Aura::GetId() const
 {
     return GetSpellInfo()->Id;
@@ -1174,7 +1190,7 @@ void Aura::UnregisterSingleTarget()
         LOG_ERROR("spells", "Aura::UnregisterSingleTarget: No caster was found."); //ASSERT(caster);
     }
     else
-        caster->GetSingleCastAuras().remove(this);
+        std::erase(caster->GetSingleCastAuras(), this);
 
     SetIsSingleTarget(false);
 }
@@ -2346,11 +2362,10 @@ void Aura::TriggerProcOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo)
 
 void Aura::_DeleteRemovedApplications()
 {
-    while (!m_removedApplications.empty())
-    {
-        delete m_removedApplications.front();
-        m_removedApplications.pop_front();
-    }
+    for (AuraApplication* aurApp : m_removedApplications)
+        delete aurApp;
+
+    m_removedApplications.clear();
 }
 
 void Aura::LoadScripts()
@@ -181,6 +181,7 @@ enum WorldBoolConfigs
     CONFIG_MUNCHING_BLIZZLIKE,
     CONFIG_ENABLE_DAZE,
     CONFIG_SPELL_QUEUE_ENABLED,
+    CONFIG_AGGREGATE_MOVEMENT,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -342,6 +343,10 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_CONTINENTS,
+    CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_INSTANCES,
+    CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_BGARENAS,
+    CONFIG_IDLE_CREATURE_FULL_UPDATE_DISTANCE,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR, // pussywizard
@@ -428,6 +433,7 @@ enum WorldIntConfigs
     CONFIG_SUNSREACH_COUNTER_MAX,
     CONFIG_RESPAWN_DYNAMICMINIMUM_GAMEOBJECT,
     CONFIG_RESPAWN_DYNAMICMINIMUM_CREATURE,
+    CONFIG_GAME_EVENT_SPAWN_BUDGET,
     INT_CONFIG_VALUE_COUNT
 };
 
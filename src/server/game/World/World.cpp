@@ -60,10 +60,12 @@
 #include "LootItemStorage.h"
 #include "LootMgr.h"
 #include "M2Stores.h"
+#include "MemoryTracker.h"
 #include "MMapFactory.h"
 #include "MapMgr.h"
 #include "Metric.h"
 #include "MotdMgr.h"
+#include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
@@ -400,6 +402,7 @@ void World::LoadConfigSettings(bool reload)
         LOG_ERROR("server.loading", "Compression level ({}) must be in range 1..9. Using default compression level (1).", _int_configs[CONFIG_COMPRESSION]);
         _int_configs[CONFIG_COMPRESSION] = 1;
     }
+    _bool_configs[CONFIG_AGGREGATE_MOVEMENT]              = sConfigMgr->GetOption<bool>("Network.AggregateMovement", false);
     _bool_configs[CONFIG_ADDON_CHANNEL]                   = sConfigMgr->GetOption<bool>("AddonChannel", true);
     _bool_configs[CONFIG_CLEAN_CHARACTER_DB]              = sConfigMgr->GetOption<bool>("CleanCharacterDB", false);
     _int_configs[CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS] = sConfigMgr->GetOption<int32>("PersistentCharacterCleanFlags", 0);
@@ -1126,6 +1129,11 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_SHOW_MUTE_IN_WORLD]         = sConfigMgr->GetOption<bool>("ShowMuteInWorld", false);
     _bool_configs[CONFIG_SHOW_BAN_IN_WORLD]          = sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS]                  = sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _int_configs[CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_CONTINENTS] = sConfigMgr->GetOption<int32>("MapUpdate.IdleCreatures.Interval.Continents", 0);
+    _int_configs[CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_INSTANCES]  = sConfigMgr->GetOption<int32>("MapUpdate.IdleCreatures.Interval.Instances", 0);
+    _int_configs[CONFIG_IDLE_CREATURE_UPDATE_INTERVAL_BGARENAS]   = sConfigMgr->GetOption<int32>("MapUpdate.IdleCreatures.Interval.BGArenas", 0);
+    _int_configs[CONFIG_IDLE_CREATURE_FULL_UPDATE_DISTANCE]       = sConfigMgr->GetOption<int32>("MapUpdate.IdleCreatures.FullUpdateDistance", 100);
+    _int_configs[CONFIG_GAME_EVENT_SPAWN_BUDGET]                  = sConfigMgr->GetOption<int32>("MapUpdate.GameEventSpawnBudget", 5);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1277,6 +1285,9 @@ void World::LoadConfigSettings(bool reload)
 /// Initialize the World
 void World::SetInitialWorldSettings()
 {
+    // static data loaded at startup, most of it is owned by ObjectMgr
+    Acore::MemoryTagScope memoryTag(MemoryTag::ObjectMgr);
+
     ///- Server startup begin
     uint32 startupBegin = getMSTime();
 
@@ -2087,7 +2098,7 @@ void World::Update(uint32 diff)
 
         // moved here from HandleCharEnumOpcode
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, SQL_OPERATION_PRIORITY_BACKGROUND);
     }
 
     ///- Update Who List Cache
@@ -2174,7 +2185,7 @@ void World::Update(uint32 diff)
             LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
             stmt->SetData(0, sWorld->getIntConfig(CONFIG_LOGDB_CLEARTIME));
             stmt->SetData(1, uint32(currentGameTime.count()));
-            LoginDatabase.Execute(stmt);
+            LoginDatabase.Execute(stmt, SQL_OPERATION_PRIORITY_BACKGROUND);
         }
     }
 
@@ -2189,6 +2200,9 @@ void World::Update(uint32 diff)
         sMapMgr->Update(diff);
     }
 
+    // map threads are idle until the next map update, nothing can still read replaced snapshots
+    ObjectAccessor::ReclaimRetiredSnapshots();
+
     if (sWorld->getBoolConfig(CONFIG_AUTOBROADCAST))
     {
         if (_timers[WUPDATE_AUTOBROADCAST].Passed())
@@ -21,9 +21,11 @@
 #include "GameTime.h"
 #include "GitRevision.h"
 #include "Log.h"
+#include "MemoryTracker.h"
 #include "ModuleMgr.h"
 #include "MotdMgr.h"
 #include "MySQLThreading.h"
+#include "ObjectPool.h"
 #include "Realm.h"
 #include "StringConvert.h"
 #include "UpdateTime.h"
@@ -84,7 +86,9 @@ public:
             { "idlerestart",  serverIdleRestartCommandTable },
             { "idleshutdown", serverIdleShutdownCommandTable },
             { "info",         HandleServerInfoCommand,           SEC_PLAYER,        Console::Yes },
+            { "memory",       HandleServerMemoryCommand,         SEC_ADMINISTRATOR, Console::Yes },
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
+            { "pools",        HandleServerPoolsCommand,          SEC_ADMINISTRATOR, Console::Yes },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
             { "set",          serverSetCommandTable }
@@ -280,6 +284,35 @@ public:
 
         return true;
     }
+
+    // Display the heap memory accounted to each subsystem
+    static bool HandleServerMemoryCommand(ChatHandler* handler)
+    {
+        if (!Acore::MemoryTracker::IsEnabled())
+        {
+            handler->SendErrorMessage("Memory tracking is not available, the core must be built with WITH_MEMORY_TRACKING.");
+            return false;
+        }
+
+        for (uint8 tag = 0; tag < uint8(MemoryTag::Max); ++tag)
+        {
+            Acore::MemoryTracker::Statistics statistics = Acore::MemoryTracker::GetStatistics(MemoryTag(tag));
+            handler->PSendSysMessage("{}: {} KB in {} allocations", Acore::MemoryTracker::GetTagName(MemoryTag(tag)), statistics.Bytes / 1024, statistics.Allocations);
+        }
+
+        return true;
+    }
+
+    // Display the object pools used by creatures, gameobjects, spells and auras
+    static bool HandleServerPoolsCommand(ChatHandler* handler)
+    {
+        for (Acore::ObjectPool::Statistics const& statistics : Acore::ObjectPool::GetAllStatistics())
+            handler->PSendSysMessage("{}: {} live objects, {} allocations from pool, {} from heap, {} free blocks in depot",
+                statistics.Name, statistics.GetLiveObjects(), statistics.PoolAllocations, statistics.HeapAllocations, statistics.DepotBlocks);
+
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler)
     {
@@ -226,6 +226,8 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         LOG_INFO("server.authserver", "Removed realm \"{}\".", itr->second);
 
+    ++_updateCounter;
+
     if (_updateInterval)
     {
         _updateTimer->expires_at(Acore::Asio::SteadyTimer::GetExpirationTime(_updateInterval));
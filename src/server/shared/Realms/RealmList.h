@@ -22,6 +22,7 @@
 #include "Realm.h"
 #include <boost/asio/steady_timer.hpp>
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory> // NOTE: this import is NEEDED (even though some IDEs report it as unused)
 #include <vector>
@@ -63,6 +64,9 @@ public:
 
     [[nodiscard]] RealmBuildInfo const* GetBuildInfo(uint32 build) const;
 
+    /// Incremented every time the realm list is reloaded, lets users know when data derived from it is outdated
+    [[nodiscard]] uint32 GetUpdateCounter() const { return _updateCounter; }
+
 private:
     RealmList();
     ~RealmList() = default;
@@ -76,6 +80,7 @@ private:
     std::vector<RealmBuildInfo> _builds;
     RealmMap _realms;
     uint32 _updateInterval{0};
+    std::atomic<uint32> _updateCounter{0};
     std::unique_ptr<boost::asio::steady_timer> _updateTimer;
     std::unique_ptr<Acore::Asio::Resolver> _resolver;
 };
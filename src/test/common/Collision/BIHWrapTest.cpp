@@ -0,0 +1,324 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BoundingIntervalHierarchyWrapper.h"
+#include "gtest/gtest.h"
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct TestBox
+    {
+        G3D::AABox Bounds;
+    };
+
+    // counts the bounds queried by tree builds, a rebuild queries every model in the cell
+    struct CountingBounds
+    {
+        static inline uint32 BuildQueries = 0;
+
+        static void GetBounds(TestBox const& box, G3D::AABox& out) { out = box.Bounds; }
+        static void GetBounds2(TestBox const* box, G3D::AABox& out) { out = box->Bounds; ++BuildQueries; }
+    };
+
+    typedef BIHWrap<TestBox, CountingBounds> TestTree;
+
+    struct RayCallback
+    {
+        TestBox const* Hit = nullptr;
+
+        bool operator()(G3D::Ray const& ray, TestBox const& box, float& maxDist, bool /*stopAtFirstHit*/)
+        {
+            float dist = ray.intersectionTime(box.Bounds);
+            if (dist >= maxDist)
+                return false;
+
+            maxDist = dist;
+            Hit = &box;
+            return true;
+        }
+    };
+
+    struct PointCallback
+    {
+        uint32 Hits = 0;
+
+        void operator()(G3D::Vector3 const& point, TestBox const& box)
+        {
+            if (box.Bounds.contains(point))
+                ++Hits;
+        }
+    };
+
+    std::unique_ptr<TestBox> MakeBox(float x, float y, float size = 1.0f)
+    {
+        return std::make_unique<TestBox>(TestBox{ G3D::AABox(G3D::Vector3(x, y, 0.0f), G3D::Vector3(x + size, y + size, size)) });
+    }
+
+    G3D::Ray RayAlongX(float y)
+    {
+        return G3D::Ray::fromOriginAndDirection(G3D::Vector3(-10.0f, y, 0.5f), G3D::Vector3(1.0f, 0.0f, 0.0f));
+    }
+
+    float Intersect(TestTree& tree, G3D::Ray const& ray, TestBox const** hit)
+    {
+        RayCallback callback;
+        float maxDist = 1000.0f;
+        tree.intersectRay(ray, callback, maxDist, false);
+        *hit = callback.Hit;
+        return maxDist;
+    }
+
+    float BruteForce(std::vector<TestBox const*> const& live, G3D::Ray const& ray)
+    {
+        float maxDist = 1000.0f;
+        for (TestBox const* box : live)
+            maxDist = std::min(maxDist, ray.intersectionTime(box->Bounds));
+        return maxDist;
+    }
+}
+
+TEST(BIHWrapTest, InsertIntersectRemove)
+{
+    TestTree tree;
+    std::unique_ptr<TestBox> near = MakeBox(0.0f, 0.0f);
+    std::unique_ptr<TestBox> far = MakeBox(5.0f, 0.0f);
+    tree.insert(*near);
+    tree.insert(*far);
+
+    TestBox const* hit = nullptr;
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(0.5f), &hit), 10.0f);
+    EXPECT_EQ(hit, near.get());
+
+    tree.balance();
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(0.5f), &hit), 10.0f);
+    EXPECT_EQ(hit, near.get());
+
+    tree.remove(*near);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(0.5f), &hit), 15.0f);
+    EXPECT_EQ(hit, far.get());
+
+    tree.remove(*far);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(0.5f), &hit), 1000.0f);
+    EXPECT_EQ(hit, nullptr);
+
+    PointCallback points;
+    tree.intersectPoint(G3D::Vector3(5.5f, 0.5f, 0.5f), points);
+    EXPECT_EQ(points.Hits, 0u);
+}
+
+TEST(BIHWrapTest, BalanceKeepsBuiltModels)
+{
+    TestTree tree;
+    std::vector<std::unique_ptr<TestBox>> boxes;
+    for (uint32 i = 0; i < 4; ++i)
+    {
+        boxes.push_back(MakeBox(float(i) * 2.0f, float(i) * 2.0f));
+        tree.insert(*boxes.back());
+        tree.balance();
+    }
+
+    for (uint32 i = 0; i < 4; ++i)
+    {
+        TestBox const* hit = nullptr;
+        Intersect(tree, RayAlongX(float(i) * 2.0f + 0.5f), &hit);
+        EXPECT_EQ(hit, boxes[i].get());
+
+        PointCallback points;
+        tree.intersectPoint(G3D::Vector3(float(i) * 2.0f + 0.5f, float(i) * 2.0f + 0.5f, 0.5f), points);
+        EXPECT_EQ(points.Hits, 1u);
+    }
+}
+
+TEST(BIHWrapTest, RebuildThresholds)
+{
+    TestTree tree;
+    std::vector<std::unique_ptr<TestBox>> boxes;
+    for (uint32 i = 0; i < 20; ++i)
+    {
+        boxes.push_back(MakeBox(0.0f, float(i) * 2.0f));
+        tree.insert(*boxes.back());
+    }
+
+    tree.balance();
+    TestBox const* hit = nullptr;
+
+    // up to 8 pending models are scanned without a rebuild
+    std::vector<std::unique_ptr<TestBox>> pending;
+    for (uint32 i = 0; i < 8; ++i)
+    {
+        pending.push_back(MakeBox(5.0f, float(i) * 2.0f + 1.0f));
+        tree.insert(*pending.back());
+    }
+
+    uint32 queries = CountingBounds::BuildQueries;
+    Intersect(tree, RayAlongX(1.5f), &hit);
+    EXPECT_EQ(hit, pending[0].get());
+    EXPECT_EQ(CountingBounds::BuildQueries, queries);
+
+    pending.push_back(MakeBox(5.0f, 17.0f));
+    tree.insert(*pending.back());
+    Intersect(tree, RayAlongX(17.5f), &hit);
+    EXPECT_EQ(hit, pending.back().get());
+    EXPECT_GT(CountingBounds::BuildQueries, queries);
+
+    // 29 built models, up to a quarter of them may leave an empty slot
+    for (uint32 i = 0; i < 7; ++i)
+        tree.remove(*boxes[i]);
+
+    queries = CountingBounds::BuildQueries;
+    Intersect(tree, RayAlongX(0.5f), &hit);
+    EXPECT_EQ(hit, nullptr);
+    EXPECT_EQ(CountingBounds::BuildQueries, queries);
+
+    tree.remove(*boxes[7]);
+    Intersect(tree, RayAlongX(14.5f), &hit);
+    EXPECT_EQ(hit, nullptr);
+    EXPECT_GT(CountingBounds::BuildQueries, queries);
+
+    Intersect(tree, RayAlongX(16.5f), &hit);
+    EXPECT_EQ(hit, boxes[8].get());
+}
+
+TEST(BIHWrapTest, ReinsertSameModel)
+{
+    TestTree tree;
+    std::vector<std::unique_ptr<TestBox>> boxes;
+    for (uint32 i = 0; i < 8; ++i)
+    {
+        boxes.push_back(MakeBox(0.0f, float(i) * 2.0f));
+        tree.insert(*boxes.back());
+    }
+
+    tree.balance();
+    TestBox const* hit = nullptr;
+    uint32 queries = CountingBounds::BuildQueries;
+
+    // a toggled door takes its old slot back
+    tree.remove(*boxes[3]);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(6.5f), &hit), 1000.0f);
+    tree.insert(*boxes[3]);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(6.5f), &hit), 10.0f);
+    EXPECT_EQ(hit, boxes[3].get());
+
+    tree.balance();
+    EXPECT_EQ(CountingBounds::BuildQueries, queries);
+
+    // a moved model is pending until the next build
+    tree.remove(*boxes[5]);
+    boxes[5]->Bounds = G3D::AABox(G3D::Vector3(3.0f, 20.0f, 0.0f), G3D::Vector3(4.0f, 21.0f, 1.0f));
+    tree.insert(*boxes[5]);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(10.5f), &hit), 1000.0f);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(20.5f), &hit), 13.0f);
+    EXPECT_EQ(hit, boxes[5].get());
+
+    tree.insert(*boxes[5]);
+    tree.balance();
+    EXPECT_GT(CountingBounds::BuildQueries, queries);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(10.5f), &hit), 1000.0f);
+    EXPECT_FLOAT_EQ(Intersect(tree, RayAlongX(20.5f), &hit), 13.0f);
+    EXPECT_EQ(hit, boxes[5].get());
+}
+
+// cell churn of a siege battleground: 200 doors toggled and 10 transports moved every tick
+TEST(BIHWrapTest, DoorAndTransportChurnMatchesBruteForce)
+{
+    constexpr uint32 Cells = 8;
+    constexpr uint32 StaticPerCell = 300;
+    constexpr uint32 Doors = 200;
+    constexpr uint32 Transports = 10;
+    constexpr uint32 Ticks = 50;
+
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> position(0.0f, 100.0f);
+
+    std::vector<TestTree> cells(Cells);
+    std::vector<std::unique_ptr<TestBox>> boxes;
+    std::vector<uint32> cellOf;
+    std::vector<bool> live;
+
+    auto add = [&](uint32 cell)
+    {
+        boxes.push_back(MakeBox(position(rng), position(rng), 0.5f));
+        cellOf.push_back(cell);
+        live.push_back(true);
+        cells[cell].insert(*boxes.back());
+    };
+
+    for (uint32 cell = 0; cell < Cells; ++cell)
+        for (uint32 i = 0; i < StaticPerCell; ++i)
+            add(cell);
+
+    uint32 const firstDoor = boxes.size();
+    for (uint32 i = 0; i < Doors; ++i)
+        add(i % Cells);
+
+    uint32 const firstTransport = boxes.size();
+    for (uint32 i = 0; i < Transports; ++i)
+        add(i % Cells);
+
+    for (TestTree& cell : cells)
+        cell.balance();
+
+    uint32 const queriesBefore = CountingBounds::BuildQueries;
+
+    for (uint32 tick = 0; tick < Ticks; ++tick)
+    {
+        for (uint32 i = firstDoor; i < firstTransport; ++i)
+        {
+            if (live[i])
+                cells[cellOf[i]].remove(*boxes[i]);
+            else
+                cells[cellOf[i]].insert(*boxes[i]);
+
+            live[i] = !live[i];
+        }
+
+        for (uint32 i = firstTransport; i < boxes.size(); ++i)
+        {
+            TestTree& cell = cells[cellOf[i]];
+            cell.remove(*boxes[i]);
+            G3D::Vector3 step(0.25f, 0.1f, 0.0f);
+            boxes[i]->Bounds = G3D::AABox(boxes[i]->Bounds.low() + step, boxes[i]->Bounds.high() + step);
+            cell.insert(*boxes[i]);
+        }
+
+        for (uint32 cell = 0; cell < Cells; ++cell)
+        {
+            std::vector<TestBox const*> liveInCell;
+            for (uint32 i = 0; i < boxes.size(); ++i)
+                if (live[i] && cellOf[i] == cell)
+                    liveInCell.push_back(boxes[i].get());
+
+            for (uint32 ray = 0; ray < 16; ++ray)
+            {
+                G3D::Ray r = G3D::Ray::fromOriginAndDirection(G3D::Vector3(-10.0f, position(rng), 0.25f), G3D::Vector3(1.0f, position(rng) / 200.0f - 0.25f, 0.0f).direction());
+                TestBox const* hit = nullptr;
+                float dist = Intersect(cells[cell], r, &hit);
+                EXPECT_FLOAT_EQ(dist, BruteForce(liveInCell, r));
+            }
+        }
+    }
+
+    // rebuilding every touched cell on every tick queries each model twice per build
+    uint32 const fullRebuildQueries = Ticks * uint32(boxes.size()) * 2;
+    EXPECT_LT(CountingBounds::BuildQueries - queriesBefore, fullRebuildQueries / 10);
+}
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    std::vector<uint32> ExecuteAll(EventMap& events)
+    {
+        std::vector<uint32> executed;
+        while (uint32 eventId = events.ExecuteEvent())
+            executed.push_back(eventId);
+
+        return executed;
+    }
+}
+
+TEST(EventMapTest, ExecutesByTime)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 2000ms);
+    events.ScheduleEvent(2, 1000ms);
+    events.ScheduleEvent(3, 3000ms);
+
+    events.Update(999ms);
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+    EXPECT_EQ(events.GetNextEventTime(), 1000u);
+
+    events.Update(2001ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2, 1, 3 }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, SameTimeKeepsScheduleOrder)
+{
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= 20; ++eventId)
+        events.ScheduleEvent(eventId, 1000ms);
+
+    events.Update(1000ms);
+
+    std::vector<uint32> expected;
+    for (uint32 eventId = 1; eventId <= 20; ++eventId)
+        expected.push_back(eventId);
+
+    EXPECT_EQ(ExecuteAll(events), expected);
+}
+
+TEST(EventMapTest, RescheduleMovesBehindSameTime)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 1000ms);
+    events.ScheduleEvent(2, 1000ms);
+    events.ScheduleEvent(3, 1000ms);
+    events.RescheduleEvent(1, 1000ms);
+
+    events.Update(1000ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2, 3, 1 }));
+}
+
+TEST(EventMapTest, DelayEventsKeepsRelativeOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 1000ms, 1);
+    events.ScheduleEvent(2, 1000ms);
+    events.ScheduleEvent(3, 1000ms, 1);
+    events.ScheduleEvent(4, 2000ms);
+
+    // group 1 is reinserted behind event 4, which already was at the delayed time
+    events.DelayEvents(1000, 1);
+
+    events.Update(1000ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2 }));
+
+    events.Update(1000ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 4, 1, 3 }));
+}
+
+TEST(EventMapTest, DelayEventsWithoutGroupDelaysAll)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 1000ms, 1);
+    events.ScheduleEvent(2, 500ms);
+    events.ScheduleEvent(3, 1000ms, 2);
+
+    events.DelayEvents(500, 0);
+
+    events.Update(1000ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2 }));
+
+    events.Update(500ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 1, 3 }));
+}
+
+TEST(EventMapTest, DelayEventsToMaxKeepsRelativeOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(4, 1000ms);
+    events.ScheduleEvent(1, 500ms, 1);
+    events.ScheduleEvent(2, 200ms, 1);
+    events.ScheduleEvent(3, 500ms, 1);
+    events.ScheduleEvent(5, 5000ms, 1);
+    events.ScheduleEvent(6, 500ms, 2);
+
+    // events of group 1 due within 1000ms are moved to 1000ms, in their previous execution order
+    events.DelayEventsToMax(1000, 1);
+
+    events.Update(500ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 6 }));
+
+    events.Update(500ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 4, 2, 1, 3 }));
+
+    EXPECT_EQ(events.GetNextEventTime(), 5000u);
+}
+
+TEST(EventMapTest, SkipsEventsOfOtherPhases)
+{
+    EventMap events;
+    events.SetPhase(1);
+    events.ScheduleEvent(1, 100ms, 0, 2);
+    events.ScheduleEvent(2, 100ms, 0, 1);
+    events.ScheduleEvent(3, 100ms);
+    events.ScheduleEvent(4, 200ms, 0, 2);
+
+    events.Update(100ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2, 3 }));
+
+    // skipped events are dropped, they do not run when their phase is entered later
+    events.SetPhase(2);
+    events.Update(100ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 4 }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, CancelEventGroup)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms, 1);
+    events.ScheduleEvent(2, 100ms, 2);
+    events.ScheduleEvent(3, 100ms, 1);
+
+    events.CancelEventGroup(1);
+
+    events.Update(100ms);
+    EXPECT_EQ(ExecuteAll(events), (std::vector<uint32>{ 2 }));
+}
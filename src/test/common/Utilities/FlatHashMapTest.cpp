@@ -0,0 +1,142 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatHashMap.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    Acore::FlatHashMap<uint64, uint32> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+
+    for (uint32 i = 0; i < 1000; ++i)
+        map[uint64(i) << 32] = i;
+
+    EXPECT_EQ(map.size(), 1000u);
+    for (uint32 i = 0; i < 1000; ++i)
+    {
+        auto itr = map.find(uint64(i) << 32);
+        ASSERT_NE(itr, map.end());
+        EXPECT_EQ(itr->second, i);
+    }
+
+    EXPECT_FALSE(map.try_emplace(0, 5u).second);
+    EXPECT_EQ(map[0], 0u);
+
+    for (uint32 i = 0; i < 1000; i += 2)
+        EXPECT_EQ(map.erase(uint64(i) << 32), 1u);
+
+    EXPECT_EQ(map.erase(0), 0u);
+    EXPECT_EQ(map.size(), 500u);
+    for (uint32 i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.contains(uint64(i) << 32), (i % 2) != 0);
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMap)
+{
+    Acore::FlatHashMap<uint64, uint64> map;
+    std::unordered_map<uint64, uint64> reference;
+
+    uint64 state = 1;
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64 key = (state >> 33) % 512;
+        if (state & 1)
+        {
+            map[key] = i;
+            reference[key] = i;
+        }
+        else
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    std::size_t visited = 0;
+    for (auto const& [key, value] : map)
+    {
+        ASSERT_EQ(reference.count(key), 1u);
+        EXPECT_EQ(reference[key], value);
+        ++visited;
+    }
+
+    EXPECT_EQ(visited, reference.size());
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating)
+{
+    Acore::FlatHashSet<uint64> set;
+    for (uint64 i = 0; i < 100; ++i)
+        set.insert(i);
+
+    for (auto itr = set.begin(); itr != set.end();)
+    {
+        if (*itr % 3 == 0)
+            itr = set.erase(itr);
+        else
+            ++itr;
+    }
+
+    EXPECT_EQ(set.size(), 66u);
+    for (uint64 i = 0; i < 100; ++i)
+        EXPECT_EQ(set.count(i), (i % 3) ? 1u : 0u);
+}
+
+TEST(FlatHashMapTest, CopyMoveAndOwnership)
+{
+    Acore::FlatHashMap<uint32, std::shared_ptr<std::string>> map;
+    std::shared_ptr<std::string> value = std::make_shared<std::string>("value");
+    for (uint32 i = 0; i < 64; ++i)
+        map.emplace(i, value);
+
+    EXPECT_EQ(value.use_count(), 65);
+
+    Acore::FlatHashMap<uint32, std::shared_ptr<std::string>> copy(map);
+    EXPECT_EQ(value.use_count(), 129);
+    EXPECT_EQ(copy.size(), 64u);
+
+    Acore::FlatHashMap<uint32, std::shared_ptr<std::string>> moved(std::move(map));
+    EXPECT_EQ(value.use_count(), 129);
+    EXPECT_TRUE(map.empty());
+
+    moved.erase(1);
+    copy.clear();
+    EXPECT_EQ(value.use_count(), 64);
+    EXPECT_EQ(*moved.at(2), "value");
+}
+
+TEST(FlatHashMapTest, AtMissingKeyThrows)
+{
+    Acore::FlatHashMap<uint32, uint32> map;
+    EXPECT_THROW(map.at(1), std::out_of_range);
+
+    map.emplace(1, 10);
+    map.at(1) = 11;
+    EXPECT_EQ(map.at(1), 11u);
+
+    Acore::FlatHashMap<uint32, uint32> const& constMap = map;
+    EXPECT_EQ(constMap.at(1), 11u);
+    EXPECT_THROW(constMap.at(2), std::out_of_range);
+
+    map.erase(1);
+    EXPECT_THROW(map.at(1), std::out_of_range);
+}
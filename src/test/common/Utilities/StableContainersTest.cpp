@@ -0,0 +1,289 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "StableContainers.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <list>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct TestAura
+    {
+        uint32 Id;
+        uint32 Type;
+        int32 Amount;
+    };
+
+    std::vector<int32*> Values(Acore::StableVector<int32*> const& list)
+    {
+        return std::vector<int32*>(list.begin(), list.end());
+    }
+}
+
+TEST(StableContainersTest, VectorBehavesLikeList)
+{
+    int32 values[5] = { 0, 1, 2, 3, 4 };
+    Acore::StableVector<int32*> list;
+    for (int32& value : values)
+        list.push_back(&value);
+
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(list.front(), &values[0]);
+    EXPECT_EQ(list.back(), &values[4]);
+
+    list.remove(&values[0]);
+    list.remove(&values[4]);
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(list.front(), &values[1]);
+    EXPECT_EQ(list.back(), &values[3]);
+    EXPECT_EQ(Values(list), (std::vector<int32*>{ &values[1], &values[2], &values[3] }));
+
+    std::vector<int32*> reversed(list.rbegin(), list.rend());
+    EXPECT_EQ(reversed, (std::vector<int32*>{ &values[3], &values[2], &values[1] }));
+
+    Acore::StableVector<int32*> copy(list);
+    list.Compact();
+    EXPECT_EQ(Values(copy), Values(list));
+
+    list.remove(&values[1]);
+    list.remove(&values[2]);
+    list.remove(&values[3]);
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_EQ(copy.size(), 3u);
+
+    copy.push_back(&values[0]);
+    copy.sort([](int32 const* left, int32 const* right) { return *left < *right; });
+    EXPECT_EQ(Values(copy), (std::vector<int32*>{ &values[0], &values[1], &values[2], &values[3] }));
+}
+
+TEST(StableContainersTest, VectorIteratorsSurviveChanges)
+{
+    std::vector<int32> values(64);
+    Acore::StableVector<int32*> list;
+    for (uint32 i = 0; i < 8; ++i)
+        list.push_back(&values[i]);
+
+    // erase the current and the next element and append while iterating, like an aura handler would
+    std::vector<int32*> visited;
+    uint32 appended = 8;
+    for (Acore::StableVector<int32*>::const_iterator itr = list.begin(); itr != list.end(); ++itr)
+    {
+        int32* value = *itr;
+        visited.push_back(value);
+
+        if (value == &values[2])
+        {
+            list.remove(&values[2]);
+            list.remove(&values[3]);
+        }
+
+        if (appended < 12)
+            list.push_back(&values[appended++]);
+    }
+
+    EXPECT_EQ(visited.size(), 11u);
+    EXPECT_EQ(std::count(visited.begin(), visited.end(), &values[3]), 0);
+    EXPECT_EQ(visited.back(), &values[11]);
+    EXPECT_EQ(list.size(), 10u);
+
+    list.Compact();
+    EXPECT_EQ(Values(list).size(), 10u);
+}
+
+TEST(StableContainersTest, MultiMapMatchesMultimap)
+{
+    std::mt19937 rng(42);
+    std::vector<int32> values(2000);
+    Acore::StableMultiMap<uint32, int32*> map;
+    std::multimap<uint32, int32*> reference;
+
+    auto matches = [&]()
+    {
+        ASSERT_EQ(map.size(), reference.size());
+        for (uint32 key = 0; key < 16; ++key)
+        {
+            std::vector<int32*> expected, found;
+            for (auto itr = reference.lower_bound(key); itr != reference.upper_bound(key); ++itr)
+                expected.push_back(itr->second);
+
+            auto range = map.equal_range(key);
+            for (auto itr = range.first; itr != range.second; ++itr)
+            {
+                EXPECT_EQ(itr->first, key);
+                found.push_back(itr->second);
+            }
+
+            EXPECT_EQ(found, expected);
+            EXPECT_EQ(map.count(key), reference.count(key));
+            EXPECT_EQ(map.find(key) == map.end(), reference.find(key) == reference.end());
+        }
+    };
+
+    for (uint32 step = 0; step < 2000; ++step)
+    {
+        uint32 key = rng() % 16;
+        if (rng() % 3)
+        {
+            int32* value = &values[step];
+            map.insert({ key, value });
+            reference.insert({ key, value });
+        }
+        else
+        {
+            // erase every other element of the key while walking its range
+            bool erase = true;
+            for (auto itr = map.lower_bound(key); itr != map.upper_bound(key);)
+            {
+                if (erase)
+                {
+                    auto ref = reference.lower_bound(key);
+                    while (ref->second != itr->second)
+                        ++ref;
+                    reference.erase(ref);
+                    itr = map.erase(itr);
+                }
+                else
+                    ++itr;
+
+                erase = !erase;
+            }
+        }
+
+        if (step % 100 == 0)
+            map.Compact();
+
+        matches();
+    }
+}
+
+TEST(StableContainersTest, MultiMapIteratorsSurviveErase)
+{
+    int32 values[4] = { };
+    Acore::StableMultiMap<uint32, int32*> map;
+    map.insert({ 7, &values[0] });
+    map.insert({ 3, &values[1] });
+    map.insert({ 7, &values[2] });
+
+    Acore::StableMultiMap<uint32, int32*>::iterator updateItr = map.begin();
+    Acore::StableMultiMap<uint32, int32*>::iterator itr = map.find(3);
+    EXPECT_EQ(itr->second, &values[1]);
+
+    // erasing the element an update loop is about to visit, like Unit::RemoveOwnedAura does
+    ++updateItr;
+    EXPECT_TRUE(updateItr == itr);
+    ++updateItr;
+    itr = map.erase(itr);
+    EXPECT_TRUE(itr == updateItr);
+    EXPECT_EQ(updateItr->second, &values[2]);
+
+    map.insert({ 3, &values[3] });
+    ++updateItr;
+    EXPECT_EQ(updateItr->second, &values[3]);
+    ++updateItr;
+    EXPECT_TRUE(updateItr == map.end());
+
+    EXPECT_EQ(map.size(), 3u);
+    map.Compact();
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(std::distance(map.begin(), map.end()), 3);
+}
+
+// hot aura queries of a raid buffed player with 64 auras, timed against the node based containers they replace
+TEST(StableContainersTest, RaidBuffedUnitWorkload)
+{
+    constexpr uint32 AuraCount = 64;
+    constexpr uint32 AuraTypes = 16;
+    constexpr uint32 Rounds = 2000;
+
+    std::mt19937 rng(7);
+    std::vector<TestAura> auras(AuraCount + 8);
+    for (uint32 i = 0; i < auras.size(); ++i)
+        auras[i] = { 1000 + uint32(rng() % 50000), uint32(rng() % AuraTypes), int32(rng() % 100) };
+
+    std::multimap<uint32, TestAura*> nodeAuras;
+    std::list<TestAura*> nodeEffects[AuraTypes];
+    Acore::StableMultiMap<uint32, TestAura*> flatAuras;
+    Acore::StableVector<TestAura*> flatEffects[AuraTypes];
+
+    for (uint32 i = 0; i < AuraCount; ++i)
+    {
+        nodeAuras.insert({ auras[i].Id, &auras[i] });
+        nodeEffects[auras[i].Type].push_back(&auras[i]);
+        flatAuras.insert({ auras[i].Id, &auras[i] });
+        flatEffects[auras[i].Type].push_back(&auras[i]);
+    }
+
+    // per round: an update walk, a modifier total per aura type, 32 HasAura lookups and one buff refreshed
+    auto run = [&](auto& ownedAuras, auto* effects, auto refresh)
+    {
+        int64 checksum = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32 round = 0; round < Rounds; ++round)
+        {
+            for (auto const& [id, aura] : ownedAuras)
+                checksum += aura->Amount;
+
+            for (uint32 type = 0; type < AuraTypes; ++type)
+                for (TestAura const* aura : effects[type])
+                    checksum += aura->Amount * int64(type);
+
+            for (uint32 lookup = 0; lookup < 32; ++lookup)
+                checksum += ownedAuras.find(auras[(round + lookup * 7) % auras.size()].Id) != ownedAuras.end();
+
+            refresh(ownedAuras, effects, auras[round % AuraCount]);
+        }
+
+        return std::make_pair(checksum, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [nodeChecksum, nodeTime] = run(nodeAuras, nodeEffects, [](auto& ownedAuras, auto* effects, TestAura& aura)
+    {
+        auto itr = ownedAuras.lower_bound(aura.Id);
+        while (itr->second != &aura)
+            ++itr;
+        ownedAuras.erase(itr);
+        effects[aura.Type].remove(&aura);
+        ownedAuras.insert({ aura.Id, &aura });
+        effects[aura.Type].push_back(&aura);
+    });
+
+    auto [flatChecksum, flatTime] = run(flatAuras, flatEffects, [](auto& ownedAuras, auto* effects, TestAura& aura)
+    {
+        auto itr = ownedAuras.lower_bound(aura.Id);
+        while (itr->second != &aura)
+            ++itr;
+        ownedAuras.erase(itr);
+        effects[aura.Type].remove(&aura);
+        ownedAuras.insert({ aura.Id, &aura });
+        effects[aura.Type].push_back(&aura);
+
+        // Unit::_UpdateSpells compacts once per update
+        ownedAuras.Compact();
+        effects[aura.Type].Compact();
+    });
+
+    EXPECT_EQ(flatChecksum, nodeChecksum);
+
+    RecordProperty("MultimapAndListMicroseconds", std::to_string(nodeTime));
+    RecordProperty("StableContainersMicroseconds", std::to_string(flatTime));
+}
@@ -0,0 +1,134 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+#include <optional>
+#include <vector>
+
+namespace
+{
+    void ScheduleTracked(TaskScheduler& scheduler, std::vector<int>& executed, Milliseconds time, int id, std::optional<uint32> group = {})
+    {
+        auto task = [&executed, id](TaskContext /*context*/) { executed.push_back(id); };
+        if (group)
+            scheduler.Schedule(time, *group, task);
+        else
+            scheduler.Schedule(time, task);
+    }
+}
+
+TEST(TaskSchedulerTest, ExecutesByTime)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    ScheduleTracked(scheduler, executed, 2s, 1);
+    ScheduleTracked(scheduler, executed, 1s, 2);
+    ScheduleTracked(scheduler, executed, 3s, 3);
+
+    scheduler.Update(999ms);
+    EXPECT_TRUE(executed.empty());
+
+    scheduler.Update(2001ms);
+    EXPECT_EQ(executed, (std::vector<int>{ 2, 1, 3 }));
+}
+
+TEST(TaskSchedulerTest, SameTimeKeepsScheduleOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    std::vector<int> expected;
+    for (int id = 1; id <= 20; ++id)
+    {
+        ScheduleTracked(scheduler, executed, 1s, id);
+        expected.push_back(id);
+    }
+
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, expected);
+}
+
+TEST(TaskSchedulerTest, DelayGroupKeepsRelativeOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    ScheduleTracked(scheduler, executed, 1s, 1, 1);
+    ScheduleTracked(scheduler, executed, 1s, 2);
+    ScheduleTracked(scheduler, executed, 1s, 3, 1);
+    ScheduleTracked(scheduler, executed, 2s, 4);
+
+    // group 1 is reinserted behind task 4, which already was at the delayed time
+    scheduler.DelayGroup(1, 1s);
+
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, (std::vector<int>{ 2 }));
+
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, (std::vector<int>{ 2, 4, 1, 3 }));
+}
+
+TEST(TaskSchedulerTest, RescheduleAllKeepsExecutionOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    ScheduleTracked(scheduler, executed, 3s, 1);
+    ScheduleTracked(scheduler, executed, 1s, 2);
+    ScheduleTracked(scheduler, executed, 2s, 3);
+
+    scheduler.RescheduleAll(5s);
+
+    scheduler.Update(4s);
+    EXPECT_TRUE(executed.empty());
+
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, (std::vector<int>{ 2, 3, 1 }));
+}
+
+TEST(TaskSchedulerTest, RepeatRunsBehindSameTime)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    scheduler.Schedule(1s, [&executed](TaskContext context)
+    {
+        executed.push_back(1);
+        if (context.GetRepeatCounter() < 2)
+            context.Repeat(1s);
+    });
+    ScheduleTracked(scheduler, executed, 2s, 2);
+    ScheduleTracked(scheduler, executed, 3s, 3);
+
+    scheduler.Update(1s);
+    scheduler.Update(1s);
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, (std::vector<int>{ 1, 2, 1, 3, 1 }));
+}
+
+TEST(TaskSchedulerTest, CancelGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    ScheduleTracked(scheduler, executed, 1s, 1, 1);
+    ScheduleTracked(scheduler, executed, 1s, 2, 2);
+    ScheduleTracked(scheduler, executed, 1s, 3, 1);
+
+    EXPECT_TRUE(scheduler.IsGroupScheduled(1));
+    scheduler.CancelGroup(1);
+    EXPECT_FALSE(scheduler.IsGroupScheduled(1));
+
+    scheduler.Update(1s);
+    EXPECT_EQ(executed, (std::vector<int>{ 2 }));
+}